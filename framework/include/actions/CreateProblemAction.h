@@ -34,6 +34,7 @@ protected:
   std::vector<SubdomainName> _blocks;
   std::vector<MooseEnum> _coord_sys;
   bool _fe_cache;
+  MooseEnum _fe_cache_type;
 };
 
 #endif /* CREATEPROBLEMACTION_H */
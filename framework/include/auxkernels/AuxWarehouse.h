@@ -79,7 +79,19 @@ public:
    */
   void addScalarKernel(AuxScalarKernel *kernel);
 
+  /**
+   * Distribute the (sorted) aux kernels of this warehouse between two other warehouses, keeping their order.
+   * The kernels stay owned by this warehouse, the other two only reference them.  Scalar kernels are not distributed.
+   * @param selected The kernels going to 'in', all the others go to 'out'
+   * @param in The warehouse receiving the selected kernels
+   * @param out The warehouse receiving the other kernels
+   */
+  void split(const std::set<AuxKernel *> & selected, AuxWarehouse & in, AuxWarehouse & out) const;
+
 protected:
+  /// Whether or not the kernels are deleted with this warehouse (false for the ones filled by split())
+  bool _owns_kernels;
+
   /// all aux kernels
   std::vector<AuxKernel *> _all_aux_kernels;
   /// all element aux kernels
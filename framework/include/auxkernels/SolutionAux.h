@@ -43,6 +43,10 @@ public:
    */
   virtual ~SolutionAux();
 
+  /** Switch to direct extraction of nodal values when the solution was computed on the simulation mesh
+   */
+  virtual void initialSetup();
+
 protected:
 
   /** Compute the value for the kernel
@@ -67,6 +71,9 @@ protected:
 
   /// Additional factor added to the solution, the b of ax+b
   const Real _add_factor;
+
+  /// Element of the solution mesh containing the last point, where the next search starts
+  const Elem * _elem_hint;
 };
 
 #endif //SOLUTIONAUX_H
@@ -16,6 +16,7 @@
 #define ASSEMBLY_H
 
 #include <vector>
+#include <set>
 #include "ParallelUniqueId.h"
 #include "MooseVariable.h"
 #include "MooseVariableScalar.h"
@@ -29,6 +30,8 @@
 #include "libmesh/quadrature.h"
 #include "libmesh/elem.h"
 #include "libmesh/node.h"
+#include "libmesh/libmesh_config.h"
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 // MOOSE Forward Declares
 class MooseMesh;
@@ -309,6 +312,14 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether or not the FE cache should store the shape functions only once per element type and keep just
+   * the mapping for each affine element.  Shape function gradients are then rebuilt from the reference element.
+   *
+   * @param reference_fe_cache True for caching reference element data, false for caching everything per element.
+   */
+  void useReferenceFECache(bool reference_fe_cache) { _should_use_reference_fe_cache = reference_fe_cache; }
+
   void prepare();
 
   /**
@@ -347,6 +358,27 @@ public:
    */
   void addCachedResidual(NumericVector<Number> & residual, Moose::KernelType type);
 
+  /**
+   * Moves the values that have been cached by calling cacheResidual() and or cacheResidualNeighbor() into
+   * residual buffers private to this Assembly object.  No locking is required.
+   *
+   * Note that this will also clear the cache.
+   */
+  void accumulateCachedResidual();
+
+  /**
+   * Sums the privately accumulated residual values of another Assembly object into this one.
+   * The buffers of the other object are zeroed.
+   *
+   * @param other The Assembly object (usually belonging to another thread) to merge
+   */
+  void mergeAccumulatedResidual(Assembly & other);
+
+  /**
+   * Adds the values accumulated by accumulateCachedResidual() to the residual and zeroes the buffers.
+   */
+  void addAccumulatedResidual(NumericVector<Number> & residual, Moose::KernelType type);
+
   void setResidual(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
   void setResidualNeighbor(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
 
@@ -413,6 +445,12 @@ public:
    */
   void invalidateCache();
 
+  /**
+   * Invalidate the cached data of some elements only.
+   * @param elem_ids The ids of the elements whose FE data has to be recached
+   */
+  void invalidateCache(const std::set<dof_id_type> & elem_ids);
+
   std::map<FEType, bool> _need_second_derivative;
 
 protected:
@@ -431,6 +469,25 @@ protected:
    */
   void reinitFEFace(const Elem * elem, unsigned int side);
 
+  class AffineElementMap;
+
+  /**
+   * Whether or not the shape functions on this element can be obtained by mapping the ones on the reference element
+   */
+  bool canUseReferenceFE(const Elem * elem);
+
+  /**
+   * Reinit the volume FE data from the cached reference element data and the affine map of the element.
+   *
+   * @return false if there is no (valid) reference data yet, nothing is modified in that case
+   */
+  bool reinitFEReference(const Elem * elem, const AffineElementMap & affine_map);
+
+  /**
+   * Store the affine map of an element (and the reference element data if needed) after a full reinit on it
+   */
+  void cacheReferenceFE(const Elem * elem, AffineElementMap & affine_map);
+
   void addResidualBlock(NumericVector<Number> & residual, DenseVector<Number> & res_block, const std::vector<dof_id_type> & dof_indices, Real scaling_factor);
   void cacheResidualBlock(std::vector<Real> & cached_residual_values, std::vector<unsigned int> & cached_residual_rows, DenseVector<Number> & res_block, std::vector<dof_id_type> & dof_indices, Real scaling_factor);
 
@@ -625,6 +682,54 @@ protected:
   /// Whether or not fe should currently be cached - This will be false if something funky is going on with the quadrature rules.
   bool _currently_fe_caching;
 
+  /**
+   * Shape functions and their gradients on the reference element (the gradients are with respect to the
+   * reference coordinates).  One of these is stored per element type.
+   */
+  class ReferenceFEShapeData
+  {
+  public:
+    ReferenceFEShapeData() : _qrule(NULL), _n_points(0) {}
+
+    /// The quadrature rule this data was computed with
+    const QBase * _qrule;
+    unsigned int _n_points;
+
+    std::map<FEType, FEShapeData *> _shape_data;
+  };
+
+  /**
+   * The map from the reference element to an affine element: x = origin + jacobian * xi
+   */
+  class AffineElementMap
+  {
+  public:
+    Point _origin;
+    RealTensor _jacobian;
+    /// Maps reference gradients to physical ones (the transpose of the inverse jacobian)
+    RealTensor _grad_map;
+    /// JxW divided by the quadrature weight
+    Real _jxw_scale;
+    bool _invalidated;
+  };
+
+  /// Whether or not the fe cache should only store the mapping of affine elements
+  bool _should_use_reference_fe_cache;
+
+  /// Reference element data stored by element type
+  std::map<ElemType, ReferenceFEShapeData *> _reference_fe_shape_data;
+
+  /// Affine maps of the cached elements, numbered in the order they were first seen by this thread
+  std::vector<AffineElementMap> _affine_element_maps;
+
+  /// Index into _affine_element_maps by element id
+  LIBMESH_BEST_UNORDERED_MAP<dof_id_type, unsigned int> _affine_element_map_index;
+
+  /// Storage for the gradients, q_points and JxW rebuilt from the reference element
+  std::map<FEType, FEShapeData *> _fe_shape_data_reference;
+  MooseArray<Point> _reference_q_points;
+  MooseArray<Real> _reference_JxW;
+
   // Shape function values, gradients. second derivatives for each FE type
   std::map<FEType, FEShapeData * > _fe_shape_data;
   std::map<FEType, FEShapeData * > _fe_shape_data_face;
@@ -638,6 +743,15 @@ protected:
 
   unsigned int _max_cached_residuals;
 
+  /// Residual values accumulated for locally owned dofs, indexed by (dof - _accumulated_residual_first_dof) (the first vector is for TIME vs NONTIME)
+  std::vector<std::vector<Real> > _accumulated_residual;
+  /// Residual values accumulated for dofs owned by other processors (the first vector is for TIME vs NONTIME)
+  std::vector<std::map<dof_id_type, Real> > _accumulated_residual_nonlocal;
+  /// First locally owned dof at the time the accumulation buffers were sized
+  dof_id_type _accumulated_residual_first_dof;
+  /// Global dof indices corresponding to the entries of _accumulated_residual
+  std::vector<numeric_index_type> _accumulated_residual_rows;
+
   /// Values cached by calling cacheJacobian()
   std::vector<Real> _cached_jacobian_values;
   /// Row where the corresponding cached value should go
@@ -88,8 +88,23 @@ public:
   /**
    * Compute auxiliary variables
    * @param type Time flag of which variables should be computed
+   * @param solve_only With lazy evaluation (see setupLazyEvaluation()), only compute the residual variables
+   *                   the solve depends on and defer the others until computeDeferred() is called
    */
-  virtual void compute(ExecFlagType type = EXEC_RESIDUAL);
+  virtual void compute(ExecFlagType type = EXEC_RESIDUAL, bool solve_only = false);
+
+  /**
+   * Compute the variables deferred by the last solve_only compute() (does nothing if they are up to date)
+   */
+  void computeDeferred();
+
+  /**
+   * Split the residual aux kernels into the ones the solve depends on and the ones that can wait for the user
+   * objects and the outputs.  The solve depends on the kernels computing solve_vars, and transitively on the
+   * kernels computing the variables those kernels couple to.
+   * @param solve_vars The variables coupled by the objects taking part in the residual and Jacobian evaluations
+   */
+  void setupLazyEvaluation(const std::set<std::string> & solve_vars);
 
   /**
    * Get a list of dependent UserObjects for this exec type
@@ -136,6 +151,18 @@ protected:
 
   ExecStore<AuxWarehouse> _auxs;
 
+  /// Whether or not the residual aux kernels not needed by the solve are deferred
+  bool _lazy;
+
+  /// True if the deferred variables are out of date
+  bool _deferred_pending;
+
+  /// Residual aux kernels the solve depends on (references into _auxs)
+  std::vector<AuxWarehouse> _solve_auxs;
+
+  /// Residual aux kernels computed by computeDeferred() (references into _auxs)
+  std::vector<AuxWarehouse> _deferred_auxs;
+
   friend class AuxKernel;
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
@@ -21,11 +21,17 @@
 
 class FEProblem;
 class NonlinearSystem;
+class KernelBase;
+class MooseVariable;
 
 class ComputeJacobianThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
-  ComputeJacobianThread(FEProblem & fe_problem, NonlinearSystem & sys, SparseMatrix<Number> & jacobian);
+  /**
+   * @param colored True if no two elements of the range share any dofs (see MooseMesh::buildColoredElementRanges()),
+   *                the element contributions are then added to the matrix without locking
+   */
+  ComputeJacobianThread(FEProblem & fe_problem, NonlinearSystem & sys, SparseMatrix<Number> & jacobian, bool colored = false);
 
   // Splitting Constructor
   ComputeJacobianThread(ComputeJacobianThread & x, Threads::split split);
@@ -47,7 +53,25 @@ protected:
 
   unsigned int _num_cached;
 
+  /// Whether or not the elements of the range are colored, i.e. they can be added to the matrix concurrently
+  bool _colored;
+
+  /// Relative size of the perturbations used for the Kernels with fd_jacobian
+  Real _fd_scale;
+  /// Unperturbed element residuals of the Kernels with fd_jacobian
+  std::vector<DenseVector<Number> > _fd_re;
+  /// Scratch space for a perturbed element residual
+  DenseVector<Number> _fd_perturbed_re;
+
   virtual void computeJacobian();
+
+  /**
+   * Add the derivatives of the element residuals of kernels with respect to jvar to the element
+   * Jacobian by perturbing the degrees of freedom of jvar on the current element one at a time.
+   * Material properties are not recomputed for the perturbed values.
+   */
+  void computeFDJacobian(MooseVariable & jvar, const std::vector<KernelBase *> & kernels);
+
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian();
 };
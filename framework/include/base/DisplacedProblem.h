@@ -47,6 +47,9 @@ public:
   virtual MooseMesh & mesh() { return _mesh; }
   MooseMesh & refMesh();
 
+  /// The names of the displacement variables
+  const std::vector<std::string> & getDisplacementVarNames() const { return _displacements; }
+
   DisplacedSystem & nlSys() { return _displaced_nl; }
   DisplacedSystem & auxSys() { return _displaced_aux; }
 
@@ -66,6 +69,26 @@ public:
   virtual void syncSolutions(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln);
   virtual void updateMesh(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln);
 
+  /**
+   * Move the mesh like updateMesh(soln, aux_soln) but only update the geometric search if it is
+   * requested at this stage (see the 'geometric_search_update' parameter of the Mesh block).
+   * @param stage The stage of the calculation the mesh is updated at
+   */
+  void updateMesh(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln, ExecFlagType stage);
+
+  /**
+   * Update the geometric search at a stage where the mesh is not moved, if it was explicitly requested
+   * at that stage and the mesh moved since the last search update.
+   * @param stage The stage of the calculation
+   */
+  void updateGeomSearchAt(ExecFlagType stage);
+
+  /**
+   * Rebuild the range of local and ghosted nodes of the displaced mesh, the nodes moved by updateMesh()
+   * @param ghosted_elems The elements ghosted for the geometric searches
+   */
+  void updateActiveSemiLocalNodeRange(std::set<unsigned int> & ghosted_elems);
+
   virtual bool isTransient() const { return _mproblem.isTransient(); }
   virtual Moose::CoordinateSystemType getCoordSystem(SubdomainID sid) { return _mproblem.getCoordSystem(sid); }
 
@@ -119,6 +142,9 @@ public:
 
   virtual void addCachedResidualDirectly(NumericVector<Number> & residual, THREAD_ID tid);
 
+  virtual void accumulateCachedResidual(THREAD_ID tid);
+  virtual void addAccumulatedResiduals();
+
   virtual void setResidual(NumericVector<Number> & residual, THREAD_ID tid);
   virtual void setResidualNeighbor(NumericVector<Number> & residual, THREAD_ID tid);
 
@@ -210,6 +236,37 @@ protected:
   ExodusOutput * _ex;
   bool _seq;
 
+  /// Whether or not the geometric search is updated with every mesh update
+  bool _search_always;
+  /// The stages the geometric search is updated at (if not _search_always)
+  std::set<ExecFlagType> _search_stages;
+  /// Whether or not the mesh moved since the last update of the geometric search
+  bool _moved_since_search;
+
+  /// Whether or not the displacement gather tables are up to date with the dof numbering
+  bool _gather_tables_built;
+  /// Whether or not displacement i is an aux variable (a nonlinear variable otherwise)
+  std::vector<bool> _displacement_is_aux;
+  /// The local and ghosted nodes of the displaced mesh, the nodes the gather tables are built for
+  std::vector<Node *> _gather_nodes;
+  /// The dof of displacement i at _gather_nodes[n] is at [n * _displacements.size() + i] (DofObject::invalid_id if there is none)
+  std::vector<dof_id_type> _displacement_dofs;
+  /// The reference coordinates, stored like _displacement_dofs
+  std::vector<Real> _reference_coords;
+  /// Set by UpdateDisplacedMeshThread for the nodes that moved during the last mesh update, indexed like _gather_nodes
+  std::vector<char> _node_moved;
+
+  /**
+   * Build the flat (node, direction) tables mapping the displacement dofs to the coordinates they move.
+   */
+  void buildGatherTables();
+
+  /**
+   * Move the mesh and invalidate the cached FE data of the elements that moved.
+   * @return true if any node moved
+   */
+  bool moveMesh(const NumericVector<Number> & soln, const NumericVector<Number> & aux_soln);
+
 private:
   /**
    * NOTE: This is an internal function meant for MOOSE use only!
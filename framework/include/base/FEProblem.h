@@ -39,6 +39,7 @@
 #include "Restartable.h"
 #include "SolverParams.h"
 #include "OutputWarehouse.h"
+#include "DeferredReduction.h"
 
 class DisplacedProblem;
 class OutputProblem;
@@ -271,6 +272,14 @@ public:
    */
   virtual void useFECache(bool fe_cache);
 
+  /**
+   * Whether or not the FE cache should only store the mapping of affine elements and keep the shape
+   * functions once per element type (see Assembly::useReferenceFECache()).
+   *
+   * @param reference_fe_cache True for caching reference element data.
+   */
+  void useReferenceFECache(bool reference_fe_cache);
+
   virtual void init();
   virtual void init2();
   virtual void solve();
@@ -423,6 +432,11 @@ public:
    */
   bool hasUserObject(const std::string & name);
 
+  /**
+   * The parallel reductions user objects register while they are being finalized
+   */
+  DeferredReduction & deferredReduction() { return _deferred_reduction; }
+
   /**
    * Check existence of the postprocessor.
    * @param name The name of the post-processor
@@ -478,6 +492,11 @@ public:
    */
   MultiApp * getMultiApp(const std::string & multi_app_name);
 
+  /**
+   * Whether the problem has MultiApps executed at any ExecFlagType
+   */
+  bool hasMultiApps();
+
   /**
    * Execute the MultiApps associated with the ExecFlagType
    */
@@ -571,6 +590,41 @@ public:
    */
   virtual void addCachedResidualDirectly(NumericVector<Number> & residual, THREAD_ID tid);
 
+  /**
+   * Moves the cached residual contributions of a thread into that thread's private accumulation buffers (no locking).
+   * Used when thread local residual assembly is turned on.
+   *
+   * @param tid The thread id.
+   */
+  virtual void accumulateCachedResidual(THREAD_ID tid);
+
+  /**
+   * Reduces the privately accumulated residual contributions of all threads (in thread order) and adds them to the residual vectors.
+   */
+  virtual void addAccumulatedResiduals();
+
+  /**
+   * Whether or not the residual should be assembled into thread local buffers instead of the shared vector.
+   *
+   * @param thread_local_residual True for thread local accumulation, false for the locked path.
+   */
+  void useThreadLocalResidual(bool thread_local_residual) { _thread_local_residual = thread_local_residual; }
+  bool threadLocalResidual() { return _thread_local_residual; }
+
+  /**
+   * Whether or not the residual aux kernels the solve does not depend on are deferred until they are needed
+   * by the user objects, the outputs or the other aux kernels
+   */
+  bool lazyAuxKernels() { return _lazy_aux_kernels; }
+
+  /**
+   * Whether or not the Jacobian should be assembled color by color without locking.
+   *
+   * @param colored_jacobian True for colored assembly, false for the locked path.
+   */
+  void useColoredJacobian(bool colored_jacobian) { _colored_jacobian = colored_jacobian; }
+  bool coloredJacobian() { return _colored_jacobian; }
+
   virtual void setResidual(NumericVector<Number> & residual, THREAD_ID tid);
   virtual void setResidualNeighbor(NumericVector<Number> & residual, THREAD_ID tid);
 
@@ -634,7 +688,7 @@ public:
   OutputProblem & getOutputProblem(unsigned int refinements, MeshFileName file = "");
 
   /// \todo{Remove after new output system implemented}
-  void setMaxPPSRowsScreen(unsigned int n) { _pps_output_table_max_rows = n; }
+  void setMaxPPSRowsScreen(unsigned int n) { _pps_output_table_max_rows = n; _pps_output_table_screen.setWindow(n); }
   void setPPSFitScreen(MooseEnum m) { _pps_fit_to_screen = m; }
 
   /**
@@ -747,6 +801,9 @@ public:
 
   void setDebugPrintVarResidNorms(bool should_print) { _dbg_print_var_rnorms = should_print; }
 
+  void setDebugPrintJacobianColoring(bool should_print) { _dbg_print_jacobian_coloring = should_print; }
+  bool debugPrintJacobianColoring() { return _dbg_print_jacobian_coloring; }
+
   void setKernelTypeResidual(Moose::KernelType kt) { _kernel_type = kt; }
 
   /**
@@ -795,6 +852,14 @@ protected:
   /// Whether or not to actually solve the nonlinear system
   bool _solve;
 
+  /// Whether or not residual contributions are accumulated in thread local buffers
+  bool _thread_local_residual;
+  /// Whether or not the residual aux kernels are lazily evaluated
+  bool _lazy_aux_kernels;
+
+  /// Whether or not the Jacobian is assembled by element colors
+  bool _colored_jacobian;
+
   bool _transient;
   Real & _time;
   Real & _time_old;
@@ -848,6 +913,9 @@ protected:
   // user objects
   ExecStore<UserObjectWarehouse> _user_objects;
 
+  /// The reductions of the user objects being finalized together
+  DeferredReduction _deferred_reduction;
+
   ExecStore<MultiAppWarehouse> _multi_apps;
 
   /// Normal Transfers
@@ -871,7 +939,16 @@ protected:
 
   bool _print_linear_residuals; /// \todo{Remove after new output system implemented}
 
-  void computeUserObjectsInternal(std::vector<UserObjectWarehouse> & user_objects, UserObjectWarehouse::GROUP group);
+  void computeUserObjectsInternal(std::vector<UserObjectWarehouse> & user_objects, UserObjectWarehouse::GROUP group, ExecFlagType type);
+
+  /// Set up the lazy evaluation of the aux kernels from the variables coupled by the objects used in the solve
+  void setupLazyAuxKernels();
+
+  /**
+   * Reduce the values of a batch of (thread joined) user objects with one allreduce per operation,
+   * then finalize them and store the values of the postprocessors among them.
+   */
+  void finalizeUserObjects(const std::vector<UserObject *> & user_objects);
 
 public:
   /**
@@ -956,6 +1033,9 @@ protected:
   // Should we print out residuals of individaul variables at NL iterations?
   bool _dbg_print_var_rnorms;
 
+  /// Should we print the number of colors whenever the elements are colored for the Jacobian assembly?
+  bool _dbg_print_jacobian_coloring;
+
   /// true if the Jacobian is constant
   bool _const_jacobian;
   /// Indicates if the Jacobian was computed
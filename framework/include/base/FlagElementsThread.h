@@ -19,6 +19,7 @@
 
 // libMesh includes
 #include "libmesh/elem_range.h"
+#include "libmesh/numeric_vector.h"
 
 class AuxiliarySystem;
 class Adaptivity;
@@ -27,7 +28,7 @@ class DisplacedProblem;
 class FlagElementsThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
-  FlagElementsThread(FEProblem & fe_problem, std::vector<Number> & serialized_solution, DisplacedProblem * displaced_problem, unsigned int max_h_level);
+  FlagElementsThread(FEProblem & fe_problem, DisplacedProblem * displaced_problem, unsigned int max_h_level);
 
   // Splitting Constructor
   FlagElementsThread(FlagElementsThread & x, Threads::split split);
@@ -44,7 +45,8 @@ protected:
   Adaptivity & _adaptivity;
   MooseVariable & _field_var;
   unsigned int _field_var_number;
-  std::vector<Number> & _serialized_solution;
+  /// The aux solution, only the (local) entries of the local elements are read
+  const NumericVector<Number> & _solution;
   unsigned int _max_h_level;
 };
 
@@ -20,13 +20,28 @@
 //libMesh
 #include "libmesh/libmesh.h"
 
+/**
+ * Initializes MPI before libMesh does when threads can run MultiApp solves concurrently
+ * (TransientMultiApp parallel_local_apps), asking for MPI_THREAD_MULTIPLE
+ */
+class MooseMPIInit
+{
+public:
+  MooseMPIInit(int argc, char *argv[]);
+  virtual ~MooseMPIInit();
+
+protected:
+  /// Whether MPI was initialized here (and has to be finalized here)
+  bool _initialized_mpi;
+};
+
 /**
  * Initialization object for any MOOSE-based application
  *
  * This object must be created in the main() of any MOOSE-based application so
  * everything is properly initialized and finalized.
  */
-class MooseInit : public LibMeshInit
+class MooseInit : private MooseMPIInit, public LibMeshInit
 {
 public:
   MooseInit(int argc, char *argv[], MPI_Comm COMM_WORLD_IN=MPI_COMM_WORLD);
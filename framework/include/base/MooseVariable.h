@@ -289,6 +289,15 @@ protected:
    */
   void getDofIndices(const Elem * elem, std::vector<dof_id_type> & dof_indices);
 
+  /**
+   * Compute the values of this variable at the quadrature points of the current element
+   * @param nqp The number of quadrature points
+   * @param phi Shape function values
+   * @param grad_phi Shape function gradients
+   * @param second_phi Shape function second derivatives (only used if second derivatives were requested)
+   */
+  void computeValuesInternal(unsigned int nqp, const VariablePhiValue & phi, const VariablePhiGradient & grad_phi, const VariablePhiSecond * second_phi);
+
 protected:
   /// Thread ID
   THREAD_ID _tid;
@@ -373,6 +382,13 @@ protected:
   VariableSecond _second_u_old_neighbor;
   VariableSecond _second_u_older_neighbor;
 
+  /// Contiguous copies of the dof values of the current element (reused by the neighbor)
+  std::vector<Real> _dof_values;
+  std::vector<Real> _dof_values_old;
+  std::vector<Real> _dof_values_older;
+  std::vector<Real> _dof_values_dot;
+  std::vector<Real> _dof_values_du_dot_du;
+
   // time derivatives
 
   /// u_dot (time derivative)
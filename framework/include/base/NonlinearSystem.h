@@ -198,6 +198,17 @@ public:
    */
   void findImplicitGeometricCouplingEntries(GeometricSearchData & geom_search_data, std::map<unsigned int, std::vector<unsigned int> > & graph);
 
+  /**
+   * Build the nonzero pattern of the Jacobian from the DofMap, the coupling matrix, DG face couplings and
+   * the implicit geometric couplings without evaluating anything.
+   * Only the couplings of the local elements are added, so the rows owned by other processors are partial;
+   * PETSc sends them to their owners when the pattern is inserted into the matrix.
+   * @param local_rows The sorted column indices of every row owned by this processor, indexed from first_dof() (output)
+   * @param off_process_rows The sorted column indices of the other rows the local elements touch (output)
+   */
+  void buildJacobianSparsity(std::vector<std::vector<unsigned int> > & local_rows,
+                             std::map<dof_id_type, std::vector<unsigned int> > & off_process_rows);
+
   /**
    * Adds entries to the Jacobian in the correct positions for couplings coming from dofs being coupled that
    * are related geometrically (i.e. near each other across a gap).
@@ -295,6 +306,11 @@ public:
    */
   void useFiniteDifferencedPreconditioner(bool use = true) { _use_finite_differenced_preconditioner = use; }
 
+  /**
+   * Set how the columns of the finite differenced preconditioner are colored
+   */
+  void setFiniteDifferencedColoring(Moose::FDColoringType type) { _fd_coloring_type = type; }
+
   /**
    * If called with a single string, it is used as the name of a the top-level decomposition split.
    * If the array is empty, no decomposition is used.
@@ -398,6 +414,19 @@ public:
 
   bool hasActiveIntegratedBCs(BoundaryID bnd_id, THREAD_ID tid) { return ! _bcs[tid].activeIntegrated(bnd_id).empty(); }
 
+  /**
+   * Refresh the lists of active Kernels, BCs and DGKernels of a thread and drop the cached
+   * variable dependencies if any of them changed.  Called before every residual and Jacobian evaluation.
+   */
+  void updateActiveObjects(THREAD_ID tid);
+
+  /**
+   * Variables needed on the elements of a subdomain by the active Kernels, the active integrated BCs
+   * on the boundaries of the subdomain and the DGKernels.  Built once per subdomain and kept until
+   * the active objects change.
+   */
+  const std::set<MooseVariable *> & getElementalMooseVariableDependencies(SubdomainID subdomain, THREAD_ID tid);
+
 public:
   FEProblem & _fe_problem;
   // FIXME: make these protected and create getters/setters
@@ -428,6 +457,13 @@ protected:
 
   void computeJacobianInternal(SparseMatrix<Number> &  jacobian);
 
+  /**
+   * Run the element Jacobian threads over a range of elements
+   * @param elem_range The elements to assemble
+   * @param colored True if the elements of the range share no dofs and can be added without locking
+   */
+  void computeJacobianElements(ConstElemRange & elem_range, SparseMatrix<Number> & jacobian, bool colored);
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
@@ -473,6 +509,9 @@ protected:
   /// Dampers for each thread
   std::vector<DamperWarehouse> _dampers;
 
+  /// Cached variable dependencies of each subdomain for each thread (see getElementalMooseVariableDependencies())
+  std::vector<std::map<SubdomainID, std::set<MooseVariable *> > > _elemental_moose_variable_dependencies;
+
   /// Decomposition splits
   SplitWarehouse _splits;
 
@@ -491,6 +530,10 @@ protected:
 
   /// Whether or not to use a finite differenced preconditioner
   bool _use_finite_differenced_preconditioner;
+  /// How the columns of the finite differenced preconditioner are colored
+  Moose::FDColoringType _fd_coloring_type;
+  /// Number of colors of the finite differenced preconditioner when it was last reported
+  unsigned int _fd_n_colors;
 #ifdef LIBMESH_HAVE_PETSC
   MatFDColoring _fdcoloring;
 #endif
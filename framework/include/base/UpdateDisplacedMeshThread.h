@@ -16,6 +16,7 @@
 #define UPDATEDISPLACEDMESHTHREAD_H
 
 #include "libmesh/numeric_vector.h"
+#include "libmesh/threads.h"
 
 #include "MooseMesh.h"
 
@@ -26,7 +27,7 @@ class UpdateDisplacedMeshThread
 public:
   UpdateDisplacedMeshThread(DisplacedProblem & problem);
 
-  void operator() (const SemiLocalNodeRange & range) const;
+  void operator() (const Threads::BlockedRange<unsigned int> & range) const;
 
 protected:
   DisplacedProblem & _problem;
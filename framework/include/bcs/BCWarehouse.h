@@ -67,7 +67,14 @@ public:
    * @param boundary_id Boundary ID
    * @return Set of active integrated BCs
    */
-  std::vector<IntegratedBC *> activeIntegrated(BoundaryID boundary_id);
+  const std::vector<IntegratedBC *> & activeIntegrated(BoundaryID boundary_id);
+
+  /**
+   * Check which integrated BCs are active (this depends on time) and rebuild the lists
+   * returned by activeIntegrated() if that changed since the last call
+   * @return true if the active integrated BCs changed
+   */
+  bool updateActiveState();
 
   /**
    * Get active nodal boundary conditions
@@ -90,6 +97,14 @@ protected:
   std::map<BoundaryID, std::vector<NodalBC *> > _nodal_bcs;
   /// presetting nodal boundary condition on a boundary
   std::map<BoundaryID, std::vector<PresetNodalBC *> > _preset_nodal_bcs;
+
+  /// active integrated boundary conditions on a boundary
+  std::map<BoundaryID, std::vector<IntegratedBC *> > _active_integrated_bcs;
+  /// Result of isActive() for all integrated BCs when _active_integrated_bcs was built
+  std::vector<bool> _active_state;
+  bool _active_state_valid;
+  /// Returned for boundaries without active integrated BCs
+  std::vector<IntegratedBC *> _no_integrated_bcs;
 };
 
 #endif // BCWAREHOUSE_H
@@ -55,7 +55,11 @@ public:
 
   void addDGKernel(DGKernel *dg_kernel);
 
-  void updateActiveDGKernels(Real t, Real dt);
+  /**
+   * Update the list of active kernels (see TransientInterface::isActive())
+   * @return true if the list changed
+   */
+  bool updateActiveDGKernels();
 
 protected:
   std::vector<DGKernel *> _active_dg_kernels;
@@ -21,6 +21,7 @@
 #include "PostprocessorInterface.h"
 #include "UserObjectInterface.h"
 #include "Restartable.h"
+#include "MooseArray.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -65,6 +66,15 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at several points at once (e.g. all the qps of an element).
+   * By default this calls value() for each point, override it when the points can share work.
+   * \param t The time
+   * \param p The Points in space
+   * \param values Upon return the function evaluated at each point
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
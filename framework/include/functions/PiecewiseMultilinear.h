@@ -17,6 +17,7 @@
 
 #include "Function.h"
 #include "GriddedData.h"
+#include "MultilinearTable.h"
 
 
 /**
@@ -37,7 +38,7 @@ public:
 
   /**
    * Create new PiecewiseMultilinear object.
-   * This calls GriddedData to do most of the work
+   * This calls GriddedData to read the data file
    */
   PiecewiseMultilinear(const std::string & name, InputParameters parameters);
   virtual ~PiecewiseMultilinear();
@@ -47,10 +48,19 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Interpolated values at all the points (e.g. the qps of an element)
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
 private:
 
-  /// object to provide function evaluations at points on the grid
-  GriddedData * _gridded_data;
+  /// the tabulated function
+  MultilinearTable * _table;
+
+  /// intervals of the last evaluation, functions are per thread so this is not shared
+  MultilinearTable::Cache _cache;
+
   /// dimension of the grid
   unsigned int _dim;
 
@@ -63,28 +73,10 @@ private:
    */
   std::vector<int> _axes;
 
-  /// the grid
-  std::vector<std::vector<Real> > _grid;
-
-  /**
-   * This does the core work.  Given a point, pt, defined
-   * on the grid (not the MOOSE simulation reference frame),
-   * interpolate the gridded data to this point
-   */
-  Real sample(const std::vector<Real> & pt);
-
   /**
-   * Operates on monotonically increasing in_arr.
-   * Finds lower_x and upper_x which satisfy in_arr[lower_x] < x <= in_arr[upper_x].
-   * End conditions: if x<in_arr[0] then lower_x = 0 = upper_x is returned
-   *                 if x>in_arr[N-1] then lower_x = N-1 = upper_x is returned (N=size of in_arr)
-   *
-   * @param in_arr The monotonically increasing vector of real numbers
-   * @param x The real value for which we want the neighbor indices
-   * @param lower_x Upon return will contain lower_x specified above
-   * @param upper_x Upon return will contain upper_x specified above
+   * Convert a time and point in the MOOSE frame to coordinates on the grid using _axes
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void toGrid(Real t, const Point & p, Real * pt_in_grid) const;
 };
 
 #endif //PIECEWISEMULTILINEAR_H
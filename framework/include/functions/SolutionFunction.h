@@ -50,6 +50,13 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /** Extract the values at several points (e.g. the qps of an element)
+   * @param t Time at which to extract
+   * @param p Spatial locations of desired data
+   * @param values The values at t and each of p
+   */
+  virtual void values(Real t, const MooseArray<Point> & p, std::vector<Real> & values);
+
   // virtual RealGradient gradient(Real t, const Point & p);
 
   /** Setup the function for use
@@ -73,6 +80,12 @@ protected:
   /// Factor to add to the solution (default = 0)
   const Real _add_factor;
 
+  /// The thread this function is used on
+  THREAD_ID _tid;
+
+  /// Element of the solution mesh containing the last point, where the next search starts
+  const Elem * _elem_hint;
+
 };
 
 #endif //SOLUTIONFUNCTION_H
@@ -66,6 +66,13 @@ public:
    */
   void reinit();
 
+  /**
+   * Rebuild the patches of all the nearest node locators if the nearest node of a slave node left its
+   * patch on any processor.  This has to be followed by a reinit of the systems (the ghosting changes).
+   * @return Whether the patches were rebuilt
+   */
+  bool reinitExceededPatches();
+
 //protected:
   SubProblem & _subproblem;
   MooseMesh & _mesh;
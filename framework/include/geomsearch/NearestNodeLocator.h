@@ -19,6 +19,7 @@
 #include "MooseMesh.h"
 #include "libmesh/vector_value.h"
 #include "Restartable.h"
+#include "KDTree.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -73,6 +74,12 @@ public:
    */
   NodeIdRange & slaveNodeRange() { return *_slave_node_range; }
 
+  /**
+   * Whether the nearest node of a slave node was outside its patch during a search since the patches were built.
+   * The patches have to be rebuilt with reinit() (which changes the ghosting and the sparsity) to find it.
+   */
+  bool patchExceeded() const { return _patch_exceeded; }
+
   /**
    * Data structure used to hold nearest node info.
    */
@@ -101,8 +108,24 @@ public:
   bool _first;
   std::vector<unsigned int> _slave_nodes;
 
+  /// The neighborhood of each slave node, used for ghosting and for the geometric coupling sparsity
   std::map<unsigned int, std::vector<unsigned int> > _neighbor_nodes;
 
+  /// The master nodes the patches were built from
+  std::vector<unsigned int> _master_nodes;
+  /// Current positions of _master_nodes
+  std::vector<Point> _master_points;
+  /// Positions of _master_nodes when the patches were built
+  std::vector<Point> _master_patch_points;
+  /// Positions of the slave nodes when the patches were built
+  std::map<unsigned int, Point> _slave_patch_points;
+  /// Distance from each slave node to the closest master node outside its patch when the patches were built
+  std::map<unsigned int, Real> _patch_clearance;
+  /// Index of _master_points, only refitted when a patch may no longer hold the nearest node of its slave node
+  KDTree _master_tree;
+
+  bool _patch_exceeded;
+
   // The following parameter controls the patch size that is searched for each nearest neighbor
   static const unsigned int _patch_size;
 };
@@ -21,7 +21,10 @@ class NearestNodeThread
 {
 public:
   NearestNodeThread(const MooseMesh & mesh,
-                    std::map<unsigned int, std::vector<unsigned int> > & neighbor_nodes);
+                    std::map<unsigned int, std::vector<unsigned int> > & neighbor_nodes,
+                    const std::map<unsigned int, Real> & patch_clearance,
+                    const std::map<unsigned int, Point> & slave_patch_points,
+                    Real master_displacement);
 
   // Splitting Constructor
   NearestNodeThread(NearestNodeThread & x, Threads::split split);
@@ -33,12 +36,24 @@ public:
   // This is the info map we're actually filling here
   std::map<unsigned int, NearestNodeLocator::NearestNodeInfo> _nearest_node_info;
 
+  /// Slave nodes whose patch may no longer hold their nearest master node
+  std::vector<unsigned int> _unbounded_nodes;
+
 protected:
   // The Mesh
   const MooseMesh & _mesh;
 
   // The neighborhood nodes associated with each node
   std::map<unsigned int, std::vector<unsigned int> > & _neighbor_nodes;
+
+  /// Distance from each slave node to the closest master node outside its patch when the patches were built
+  const std::map<unsigned int, Real> & _patch_clearance;
+
+  /// Positions of the slave nodes when the patches were built
+  const std::map<unsigned int, Point> & _slave_patch_points;
+
+  /// How far any master node moved since the patches were built
+  Real _master_displacement;
 };
 
 #endif //NEARESTNODETHREAD_H
@@ -19,6 +19,7 @@
 #include "GeometricSearchInterface.h"
 #include "Restartable.h"
 #include "PenetrationInfo.h"
+#include "BoundingVolumeHierarchy.h"
 
 // libmesh includes
 #include "libmesh/libmesh_common.h"
@@ -119,12 +120,55 @@ public:
   void saveContactStateVars();
   Real getTangentialTolerance() {return _tangential_tolerance;}
 
+  /// Number of master faces whose boxes contained a slave node during the last search (the faces projected onto)
+  unsigned int numCandidateFaces() const { return _num_candidate_faces; }
+  /// Number of slave nodes that fell back to the faces around their closest node during the last search
+  unsigned int numFallbackNodes() const { return _num_fallback_nodes; }
+
 protected:
   bool & _update_location; // Update the penetration location for nodes found last time
   Real _tangential_tolerance; // Tangential distance a node can be from a face and still be in contact
   bool _do_normal_smoothing;  // Should we do contact normal smoothing?
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+
+  /**
+   * Collect the element sides on the master boundary and their bounding boxes
+   */
+  void buildMasterSides();
+
+  /**
+   * Copy the current positions of the master boundary nodes into _master_node_points
+   * @return Whether any of them moved since the last call
+   */
+  bool updateMasterNodePoints();
+
+  /**
+   * Compute the bounding boxes of the master sides from _master_node_points
+   */
+  void computeMasterSideBoxes();
+
+  /// Whether _master_sides is up to date with the mesh
+  bool _master_sides_built;
+  /// Element sides on the master boundary (element id, side number)
+  std::vector<std::pair<unsigned int, unsigned int> > _master_sides;
+  /// Sides on the master boundary of each element, in side list order
+  std::map<unsigned int, std::vector<unsigned int> > _master_elem_sides;
+  /// Nodes of each master side as indices into _master_node_ids, the nodes of side i start at _master_side_node_offsets[i]
+  std::vector<unsigned int> _master_side_nodes;
+  std::vector<unsigned int> _master_side_node_offsets;
+  /// The nodes on the master boundary and their positions when the boxes were last computed
+  std::vector<unsigned int> _master_node_ids;
+  std::vector<Point> _master_node_points;
+  /// Bounding boxes of _master_sides inflated by the tangential tolerance
+  std::vector<MeshTools::BoundingBox> _master_side_boxes;
+  /// The tangential tolerance the boxes were inflated with
+  Real _master_side_box_inflation;
+  /// Hierarchy of _master_side_boxes, refitted when the master boundary moved
+  BoundingVolumeHierarchy _master_side_bvh;
+
+  unsigned int _num_candidate_faces;
+  unsigned int _num_fallback_nodes;
 };
 
 #endif //PENETRATIONLOCATOR_H
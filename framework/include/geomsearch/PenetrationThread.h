@@ -37,9 +37,9 @@ public:
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
                     std::map<unsigned int, std::vector<unsigned int> > & node_to_elem_map,
-                    std::vector< unsigned int > & elem_list,
-                    std::vector< unsigned short int > & side_list,
-                    std::vector< short int > & id_list);
+                    const std::vector<std::pair<unsigned int, unsigned int> > & master_sides,
+                    const std::map<unsigned int, std::vector<unsigned int> > & master_elem_sides,
+                    const BoundingVolumeHierarchy & master_side_bvh);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -48,6 +48,11 @@ public:
 
   void join(const PenetrationThread & other);
 
+  /// Number of master faces whose boxes contained a slave node
+  unsigned int _num_candidate_faces;
+  /// Number of slave nodes that fell back to the faces around their closest node
+  unsigned int _num_fallback_nodes;
+
 protected:
   SubProblem & _subproblem;
   // The Mesh
@@ -75,11 +80,12 @@ protected:
 
   std::map<unsigned int, std::vector<unsigned int> > & _node_to_elem_map;
 
-  std::vector< unsigned int > & _elem_list;
-  std::vector< unsigned short int > & _side_list;
-  std::vector< short int > & _id_list;
-
-  unsigned int _n_elems;
+  /// Element sides on the master boundary (element id, side number)
+  const std::vector<std::pair<unsigned int, unsigned int> > & _master_sides;
+  /// Sides on the master boundary of each element
+  const std::map<unsigned int, std::vector<unsigned int> > & _master_elem_sides;
+  /// Bounding volume hierarchy over _master_sides
+  const BoundingVolumeHierarchy & _master_side_bvh;
 
   THREAD_ID _tid;
 
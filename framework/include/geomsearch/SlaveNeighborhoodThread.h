@@ -17,6 +17,7 @@
 
 #include "MooseTypes.h"
 #include "MooseMesh.h"
+#include "KDTree.h"
 // libMesh
 #include "libmesh/mesh_base.h"
 // System
@@ -27,6 +28,7 @@ class SlaveNeighborhoodThread
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<unsigned int> & trial_master_nodes,
+                          const KDTree & master_tree,
                           std::map<unsigned int, std::vector<unsigned int> > & node_to_elem_map,
                           const unsigned int patch_size);
 
@@ -47,6 +49,9 @@ public:
   /// Elements that we need to ghost
   std::set<unsigned int> _ghosted_elems;
 
+  /// Distance from each slave node to the closest master node outside its patch (max Real if there is none)
+  std::map<unsigned int, Real> _patch_clearance;
+
 protected:
   /// The Mesh
   const MooseMesh & _mesh;
@@ -54,6 +59,9 @@ protected:
   /// Nodes to search against
   const std::vector<unsigned int> & _trial_master_nodes;
 
+  /// Spatial index over _trial_master_nodes
+  const KDTree & _master_tree;
+
   /// Node to elem map
   std::map<unsigned int, std::vector<unsigned int> > & _node_to_elem_map;
 
@@ -32,6 +32,7 @@ public:
 
   // See KernelBase base for documentation of these overridden methods
   virtual void computeResidual();
+  virtual void computeElemResidual(DenseVector<Number> & re);
   virtual void computeJacobian();
   virtual void computeOffDiagJacobian(unsigned int jvar);
   virtual void computeOffDiagJacobianScalar(unsigned int jvar);
@@ -79,6 +79,19 @@ public:
    */
   virtual void computeOffDiagJacobianScalar(unsigned int jvar) = 0;
 
+  /**
+   * Compute the element residual of this Kernel with the current variable values without
+   * adding it to the residual.  Used to build the Jacobian by finite differences (see fdJacobian()).
+   * @param re The element residual (output)
+   */
+  virtual void computeElemResidual(DenseVector<Number> & re);
+
+  /**
+   * Whether the Jacobian blocks of this Kernel are built by perturbing the element degrees
+   * of freedom (and calling computeElemResidual()) instead of calling computeJacobian()
+   */
+  bool fdJacobian() const { return _fd_jacobian; }
+
   /// Returns the variable number that this Kernel operates on.
   MooseVariable & variable();
 
@@ -146,6 +159,9 @@ protected:
   bool _has_diag_save_in;
   std::vector<MooseVariable*> _diag_save_in;
   std::vector<AuxVariableName> _diag_save_in_strings;
+
+  /// Whether the Jacobian of this Kernel is computed by perturbing the element degrees of freedom
+  bool _fd_jacobian;
 };
 
 #endif /* KERNELBASE_H */
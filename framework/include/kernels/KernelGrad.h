@@ -48,6 +48,11 @@ public:
    */
   virtual void computeResidual();
 
+  /**
+   * Computes the residual for the current element without adding it to the residual.
+   */
+  virtual void computeElemResidual(DenseVector<Number> & re);
+
   /**
    * Computes the jacobian for the current element.
    */
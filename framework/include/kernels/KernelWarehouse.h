@@ -49,27 +49,34 @@ public:
    * Get the list of all active kernels
    * @return The list of all active kernels
    */
-  const std::vector<KernelBase *> & active() { return _active_kernels; }
+  const std::vector<KernelBase *> & active() { return current()._active_kernels; }
 
   /**
    * Get the list of all active time kernels
    * @return The list of all active time kernels
    */
-  const std::vector<KernelBase *> & activeTime(){ return _time_kernels;}
+  const std::vector<KernelBase *> & activeTime(){ return current()._time_kernels;}
 
 
   /**
    * Get the list of all active non-time kernels
    * @return The list of all active non-time kernels
    */
-  const std::vector<KernelBase *> & activeNonTime(){ return _non_time_kernels;}
+  const std::vector<KernelBase *> & activeNonTime(){ return current()._non_time_kernels;}
 
   /**
    * Get the list of all active kernels for a variable
    * @param var The variable number
    * @return The list of all active kernels
    */
-  const std::vector<KernelBase *> & activeVar(unsigned int var) { return _active_var_kernels[var]; }
+  const std::vector<KernelBase *> & activeVar(unsigned int var);
+
+  /**
+   * Get the list of all active kernels on a subdomain without changing the current subdomain
+   * @param subdomain_id Domain ID
+   * @return The list of all active kernels
+   */
+  const std::vector<KernelBase *> & activeOnSubdomain(SubdomainID subdomain_id) { return getActiveKernels(subdomain_id)._active_kernels; }
 
   /**
    * Get list of scalar kernels
@@ -96,6 +103,13 @@ public:
    */
   void updateActiveKernels(unsigned int subdomain_id);
 
+  /**
+   * Check which kernels are active (this depends on time) and drop the cached lists of active
+   * kernels if that changed since the last call
+   * @return true if the active kernels changed
+   */
+  bool updateActiveState();
+
   /**
    * This returns a boolean to indicate whether this warehouse contains kernels
    * representing all of the subdomains, if not then the supplied set is filled in
@@ -109,16 +123,40 @@ public:
   bool subdomainsCovered(std::set<SubdomainID> & subdomains_covered, std::set<std::string> & unique_variable_count) const;
 
 protected:
-  /// Kernels active on a block and in specified time
-  std::vector<KernelBase *> _active_kernels;
-  ///  active TimeDerivitive Kernels
-  std::vector<KernelBase *> _time_kernels;
-
-  /// active NonTimeDerivitive Kernels
-  std::vector<KernelBase *> _non_time_kernels;
+  /**
+   * Lists of the kernels active on a subdomain
+   */
+  class ActiveKernels
+  {
+  public:
+    /// Kernels active on a block and in specified time
+    std::vector<KernelBase *> _active_kernels;
+    ///  active TimeDerivitive Kernels
+    std::vector<KernelBase *> _time_kernels;
+
+    /// active NonTimeDerivitive Kernels
+    std::vector<KernelBase *> _non_time_kernels;
+
+    /// Kernels active on a block and in specified time per variable
+    std::map<unsigned int, std::vector<KernelBase *> > _active_var_kernels;
+  };
+
+  /// Get the (cached) lists of kernels active on a subdomain
+  ActiveKernels & getActiveKernels(SubdomainID subdomain_id);
+
+  /// The active kernels of the current subdomain
+  const ActiveKernels & current() const { return _current != NULL ? *_current : _no_active_kernels; }
+
+  /// Active kernels of each subdomain seen so far, valid until the active state of the kernels changes
+  std::map<SubdomainID, ActiveKernels> _active_kernels_cache;
+  /// The active kernels of the subdomain set by updateActiveKernels() (NULL if none)
+  ActiveKernels * _current;
+  /// Empty lists used before any subdomain is set
+  ActiveKernels _no_active_kernels;
+  /// Result of isActive() for all kernels when the cache was filled
+  std::vector<bool> _active_state;
+  bool _active_state_valid;
 
-  /// Kernels active on a block and in specified time per variable
-  std::map<unsigned int, std::vector<KernelBase *> > _active_var_kernels;
   /// All instances of kernels
   std::vector<KernelBase *> _all_kernels;
   /// Kernels that live everywhere (on the whole domain)
@@ -38,6 +38,7 @@ public:
   GenericFunctionMaterial(const std::string & name, InputParameters parameters);
 
 protected:
+  virtual void computeProperties();
   virtual void computeQpProperties();
 
   std::vector<std::string> _prop_names;
@@ -47,6 +48,9 @@ protected:
 
   std::vector<MaterialProperty<Real> *> _properties;
   std::vector<Function *> _functions;
+
+  /// Function values at the qps of the current element
+  std::vector<Real> _values;
 };
 
 #endif //GENERICFUNCTIONMATERIAL_H
@@ -84,8 +84,31 @@ public:
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
+
+  /**
+   * Size in bytes of the value at one quadrature point if the values are plain memory that can be
+   * saved and restored as one block, 0 if they have to go through store() and load().
+   */
+  virtual unsigned int rawValueSize() { return 0; }
+
+  /**
+   * The values as a block of size() * rawValueSize() bytes (only valid if rawValueSize() > 0)
+   */
+  virtual char * rawData() { return NULL; }
 };
 
+/**
+ * Whether the values of a MaterialProperty<T> are plain memory (see PropertyValue::rawValueSize())
+ */
+template<typename T>
+struct MaterialPropertyRawData { static const bool value = false; };
+
+template<> struct MaterialPropertyRawData<Real> { static const bool value = true; };
+template<> struct MaterialPropertyRawData<int> { static const bool value = true; };
+template<> struct MaterialPropertyRawData<unsigned int> { static const bool value = true; };
+template<> struct MaterialPropertyRawData<RealVectorValue> { static const bool value = true; };
+template<> struct MaterialPropertyRawData<RealTensorValue> { static const bool value = true; };
+
 template<>
 inline void
 dataStore(std::ostream & stream, PropertyValue * & p, void * /*context*/)
@@ -175,6 +198,10 @@ public:
    */
   virtual void load(std::istream & stream);
 
+  virtual unsigned int rawValueSize() { return MaterialPropertyRawData<T>::value ? sizeof(T) : 0; }
+
+  virtual char * rawData() { return _value.size() > 0 ? reinterpret_cast<char *>(&_value[0]) : NULL; }
+
   /**
    * Friend helper function to handle scalar material property initializations
    * @param size - the size corresponding to the quadrature rule
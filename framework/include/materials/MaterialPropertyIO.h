@@ -18,6 +18,7 @@
 #include "Moose.h"
 #include "ColumnMajorMatrix.h"
 #include "DataIO.h"
+#include "MaterialProperty.h"
 
 //libMesh
 #include "libmesh/dense_matrix.h"
@@ -32,10 +33,13 @@
 class MooseMesh;
 class FEProblem;
 class MaterialPropertyStorage;
+class MSMPReader;
 
 /**
  * This class saves stateful material properties into a file.
  *
+ * The file is binary and columnar: each property of each state is one contiguous block, so restart
+ * maps the file and loads whole columns without parsing it element by element.
  */
 class MaterialPropertyIO
 {
@@ -46,7 +50,30 @@ public:
   virtual void write(const std::string & file_name);
   virtual void read(const std::string & file_name);
 
+  /**
+   * Store the properties of this processor in a stream (what write() puts in this processor's file)
+   */
+  void write(std::ostream & out);
+
+  /**
+   * The name of the file write() uses on this processor
+   */
+  std::string fileName(const std::string & file_name);
+
 protected:
+  /**
+   * Write one state (current, old or older) of a storage in columns.  The layout is:
+   * number of entries, number of properties, the index (element ids then sides of every entry)
+   * and, for every property, the byte size of its column followed by its values at each entry in index order.
+   * Properties of plain types (see PropertyValue::rawValueSize()) are written as raw memory, the others through store().
+   */
+  void storeColumns(std::ostream & stream, MaterialPropertyStorage & storage, std::vector<MaterialProperties> & props);
+
+  /**
+   * Read one state of a storage written by storeColumns()
+   */
+  void loadColumns(MSMPReader & reader, MaterialPropertyStorage & storage, std::vector<MaterialProperties> & props);
+
   FEProblem & _fe_problem;
   MooseMesh & _mesh;
   MaterialPropertyStorage & _material_props;
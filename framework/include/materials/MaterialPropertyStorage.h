@@ -17,11 +17,12 @@
 
 #include "Moose.h"
 #include "MaterialProperty.h"
-#include "HashMap.h"
 
 //libMesh
 #include "libmesh/elem.h"
 #include "libmesh/quadrature.h"
+#include "libmesh/libmesh_config.h"
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 #include <vector>
 #include <map>
@@ -34,12 +35,19 @@ class QpMap;
 /**
  * Stores the stateful material properties computed by materials.
  *
- * Thread-safe
+ * The properties are kept in flat arrays of slots (one MaterialProperties object per element side),
+ * numbered densely over the elements registered on this processor.  Element ids are mapped to their slots
+ * through a hash table, so the memory used does not depend on the size of the global mesh.  Elements have to be registered (see registerElem())
+ * outside of threaded regions, after that all accesses (swap(), swapBack(), ...) are lock free.
  */
 class MaterialPropertyStorage
 {
 public:
-  MaterialPropertyStorage();
+  /**
+   * @param per_side True if this storage holds properties for every side of an element (boundary/neighbor
+   *                 properties), false if it only holds one set per element (volume properties)
+   */
+  MaterialPropertyStorage(bool per_side = false);
   virtual ~MaterialPropertyStorage();
 
   void releaseProperties();
@@ -119,6 +127,60 @@ public:
    */
   void shift();
 
+  /**
+   * Reserve slots for the stateful properties of an element.  Registering an element more than once is a no-op.
+   *
+   * NOT thread safe: this has to be called for every element before a threaded loop touches it.
+   * @param elem The element to make room for
+   */
+  void registerElem(const Elem & elem);
+
+  /**
+   * Remove an element from the element index but keep its properties around (accessible through its pointer)
+   * until releaseDetachedElems() is called.  This is used for children of coarsened elements that are deleted
+   * from the mesh before their properties are restricted to the parent.
+   *
+   * NOT thread safe.
+   * @param elem The element to detach (must still be a valid object)
+   */
+  void detachElem(const Elem & elem);
+
+  /**
+   * Free the properties of all the detached elements and compact the storage.
+   *
+   * NOT thread safe.
+   */
+  void releaseDetachedElems();
+
+  /**
+   * @return Whether or not slots have been reserved for the element
+   */
+  bool hasElem(const Elem & elem) const { return elemSlot(elem) != libMesh::invalid_uint; }
+
+  /**
+   * @return The index of the first slot that belongs to the element (side 0), libMesh::invalid_uint if it has none
+   */
+  unsigned int elemSlot(const Elem & elem) const
+  {
+    LIBMESH_BEST_UNORDERED_MAP<dof_id_type, unsigned int>::const_iterator it = _elem_to_slot.find(elem.id());
+    return it == _elem_to_slot.end() ? libMesh::invalid_uint : it->second;
+  }
+
+  /**
+   * @return The number of slots (sides) stored for each element
+   */
+  unsigned int nSlots(const Elem & elem) const { return _per_side ? elem.n_sides() : 1; }
+
+  /**
+   * @return The index of the first slot of a detached element (the pointer is never dereferenced)
+   */
+  unsigned int detachedElemSlot(const Elem * elem) const;
+
+  /**
+   * @return The elements that have been registered, in the order of registration
+   */
+  const std::vector<const Elem *> & registeredElems() const { return _registered_elems; }
+
   /**
    * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage
    * Thread safe
@@ -147,9 +209,15 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & props() { return *_props_elem; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOld() { return *_props_elem_old; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOlder() { return *_props_elem_older; }
+  /// The flat slot arrays, use elemSlot() + side to index them
+  std::vector<MaterialProperties> & props() { return *_props_elem; }
+  std::vector<MaterialProperties> & propsOld() { return *_props_elem_old; }
+  std::vector<MaterialProperties> & propsOlder() { return *_props_elem_older; }
+
+  /// Access to the properties stored for an element side (the element has to be registered)
+  MaterialProperties & props(const Elem & elem, unsigned int side) { return (*_props_elem)[elemSlot(elem) + side]; }
+  MaterialProperties & propsOld(const Elem & elem, unsigned int side) { return (*_props_elem_old)[elemSlot(elem) + side]; }
+  MaterialProperties & propsOlder(const Elem & elem, unsigned int side) { return (*_props_elem_older)[elemSlot(elem) + side]; }
 
   bool hasProperty(const std::string & prop_name) const;
   unsigned int addProperty(const std::string & prop_name);
@@ -162,10 +230,22 @@ public:
   unsigned int getPropertyId (const std::string & prop_name);
 
 protected:
-  // indexing: [element][side]->material_properties
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_old;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_older;
+  // indexing: [elemSlot(elem) + side]->material_properties
+  std::vector<MaterialProperties> * _props_elem;
+  std::vector<MaterialProperties> * _props_elem_old;
+  std::vector<MaterialProperties> * _props_elem_older;
+
+  /// Whether we store properties for each side of an element or only one set per element
+  bool _per_side;
+
+  /// First slot of each registered element, by element id
+  LIBMESH_BEST_UNORDERED_MAP<dof_id_type, unsigned int> _elem_to_slot;
+
+  /// Registered elements (for iterating over the storage)
+  std::vector<const Elem *> _registered_elems;
+
+  /// Detached elements: pointer -> (first slot, number of slots)
+  std::map<const Elem *, std::pair<unsigned int, unsigned int> > _detached_elems;
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblem - should be useful when we will use material properties from
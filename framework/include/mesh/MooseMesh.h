@@ -266,6 +266,19 @@ public:
   ConstBndNodeRange * getBoundaryNodeRange();
   ConstBndElemRange * getBoundaryElementRange();
 
+  /**
+   * Partition the active local elements into colors so that elements of the same color touch disjoint
+   * sets of dofs.  Elements touching dofs owned by other processors are not colored but collected in a
+   * separate range.  This is built on demand and thrown away when the mesh changes.
+   *
+   * @param include_neighbors Whether elements also touch the dofs of their face neighbors (DG)
+   */
+  void buildColoredElementRanges(bool include_neighbors);
+  bool hasColoredElementRanges() const { return _has_colored_elem_ranges; }
+  const std::vector<ConstElemRange *> & getColoredElementRanges() { return _colored_elem_ranges; }
+  /// The elements excluded from the coloring (NULL if there are none)
+  ConstElemRange * getSharedColoredElementRange() { return _shared_colored_elem_range; }
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -678,6 +691,10 @@ protected:
    * to get rebuilt all the time (which takes time).
    */
   ConstElemRange * _active_local_elem_range;
+  /// Active local elements by color and the ones that could not be colored (see buildColoredElementRanges())
+  std::vector<ConstElemRange *> _colored_elem_ranges;
+  ConstElemRange * _shared_colored_elem_range;
+  bool _has_colored_elem_ranges;
   /// active local + active ghosted
   SemiLocalNodeRange * _active_semilocal_node_range;
   NodeRange * _active_node_range;
@@ -762,6 +779,7 @@ protected:
   void cacheInfo();
   void freeBndNodes();
   void freeBndElems();
+  void clearColoredElementRanges();
 
 private:
   /**
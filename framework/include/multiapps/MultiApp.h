@@ -220,6 +220,22 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Split the apps into contiguous ranges of about the same total weight, one per processor.
+   * Used when there are at least as many apps as processors and "app_weights" is given.
+   *
+   * @param first_apps The first global app of each processor, with the number of apps appended (output)
+   */
+  void partitionWeightedApps(std::vector<unsigned int> & first_apps);
+
+  /**
+   * Give each app a number of processors proportional to its weight (at least one, at most _max_procs_per_app).
+   * Used when there are fewer apps than processors and "app_weights" is given.
+   *
+   * @param first_procs The first processor of each app, with the total number of processors used appended (output)
+   */
+  void distributeWeightedProcs(std::vector<unsigned int> & first_procs);
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -286,6 +302,9 @@ protected:
   /// Maximum number of processors to give to each app
   unsigned int _max_procs_per_app;
 
+  /// The relative cost of each app, used to balance the processors (empty for an even split)
+  std::vector<Real> _app_weights;
+
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
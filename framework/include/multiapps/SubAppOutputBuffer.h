@@ -0,0 +1,78 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SUBAPPOUTPUTBUFFER_H
+#define SUBAPPOUTPUTBUFFER_H
+
+#include "Moose.h"
+
+// libMesh
+#include "libmesh/threads.h"
+
+// System
+#include <streambuf>
+#include <map>
+
+#ifdef LIBMESH_HAVE_TBB_API
+#include "tbb/tbb_thread.h"
+#endif
+
+/**
+ * Stream buffer installed in Moose::out while the sub-apps of a TransientMultiApp are solved
+ * concurrently.  What a thread writes goes to the buffer of the app that thread is solving,
+ * so the output of every app can be flushed in order once all the solves are done.  Threads
+ * not solving an app (the threaded loops inside an app) write straight through, one at a time.
+ */
+class SubAppOutputBuffer : public std::streambuf
+{
+public:
+  /**
+   * @param parent The stream buffer the output goes to when it is not redirected
+   */
+  SubAppOutputBuffer(std::streambuf * parent);
+
+  /**
+   * Send what the calling thread writes to buffer (or to the parent when NULL)
+   * @return The buffer the calling thread was writing to
+   */
+  std::streambuf * redirect(std::streambuf * buffer);
+
+protected:
+  virtual int overflow(int c);
+  virtual std::streamsize xsputn(const char * s, std::streamsize n);
+  virtual int sync();
+
+#ifdef LIBMESH_HAVE_TBB_API
+  typedef tbb::tbb_thread::id ThreadID;
+#else
+  typedef int ThreadID;
+#endif
+
+  /// The id of the calling thread
+  static ThreadID threadID();
+
+  /// The buffer of the calling thread, NULL if it is not redirected (call with _mutex locked)
+  std::streambuf * target();
+
+  /// Where the output goes when it is not redirected
+  std::streambuf * _parent;
+
+  /// The buffer of each redirected thread
+  std::map<ThreadID, std::streambuf *> _buffers;
+
+  /// Guards _buffers and the writes to _parent
+  Threads::spin_mutex _mutex;
+};
+
+#endif /* SUBAPPOUTPUTBUFFER_H */
@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SUBAPPSOLVETHREAD_H
+#define SUBAPPSOLVETHREAD_H
+
+#include "Moose.h"
+#include "MooseTypes.h"
+
+class Transient;
+class SubAppOutputBuffer;
+
+/// Range of local app numbers
+typedef StoredRange<std::vector<unsigned int>::iterator, unsigned int> LocalAppRange;
+
+/**
+ * Takes one time step of each local app of a TransientMultiApp in the range.
+ * Used with a grain size of one so every app is its own task of the thread pool.
+ */
+class SubAppSolveThread
+{
+public:
+  /**
+   * @param executioners The Transient executioner of each local app
+   * @param dt The time step to take
+   * @param output The buffer installed in Moose::out
+   * @param app_output The buffer receiving the console output of each local app
+   * @param app_perf_logs The performance log of each local app
+   */
+  SubAppSolveThread(std::vector<Transient *> & executioners, Real dt, SubAppOutputBuffer & output,
+                    std::vector<std::streambuf *> & app_output, std::vector<PerfLog *> & app_perf_logs);
+
+  void operator() (const LocalAppRange & range) const;
+
+protected:
+  std::vector<Transient *> & _executioners;
+
+  Real _dt;
+
+  SubAppOutputBuffer & _output;
+
+  std::vector<std::streambuf *> & _app_output;
+
+  std::vector<PerfLog *> & _app_perf_logs;
+};
+
+#endif /* SUBAPPSOLVETHREAD_H */
@@ -88,6 +88,21 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0, bool output_initial = true);
 
+  /**
+   * Take the time step of all the local apps at once, one app per thread (see parallel_local_apps).
+   * Only the solves are concurrent, the apps are advanced and output one after the other.
+   */
+  void solveStepConcurrently(Real dt, Real target_time, bool auto_advance);
+
+  /**
+   * End the time step of a local app, trying to catch up if its solve failed and catch_up is set.
+   *
+   * @param i The local app number
+   * @param dt The time step the app took
+   * @param target_time The time the app should be at (in global time)
+   */
+  void endAppStep(unsigned int i, Real dt, Real target_time);
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -104,6 +119,12 @@ private:
   bool _catch_up;
   Real _max_catch_up_steps;
 
+  /// Whether the local apps take their time steps concurrently
+  bool _parallel_local_apps;
+
+  /// The performance log of each local app when they are solved concurrently
+  std::vector<PerfLog *> _app_perf_logs;
+
   /// Is it our first time through the execution loop?
   bool & _first;
 
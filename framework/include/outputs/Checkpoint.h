@@ -22,6 +22,9 @@
 #include "MaterialPropertyIO.h"
 #include "RestartableDataIO.h"
 
+// libMesh includes
+#include "libmesh/threads.h"
+
 // Forward declarations
 class Checkpoint;
 struct CheckpointFileNames;
@@ -97,6 +100,12 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Wait for the background write of the previous checkpoint (if any) and rotate the files once it is on disk.
+   * @param error_on_failure Whether a failed write is an error (otherwise it is only reported)
+   */
+  void waitForWriter(bool error_on_failure = true);
+
 private:
 
   /// Max no. of output files to store
@@ -125,6 +134,21 @@ private:
 
   /// Vector of checkpoint filename structures
   std::vector<CheckpointFileNames> _file_names;
+
+  /// True if the restartable and material data are written on a background thread
+  bool _async;
+
+  /// The thread writing the pending files (NULL when there is none)
+  Threads::Thread * _writer;
+
+  /// The name and contents of the files the writer is working on
+  std::vector<std::pair<std::string, std::string> > _pending_files;
+
+  /// The checkpoint the writer is working on
+  CheckpointFileNames _pending_file_struct;
+
+  /// Set by the writer when a file could not be written
+  bool _write_failed;
 };
 
 #endif //CHECKPOINT_H
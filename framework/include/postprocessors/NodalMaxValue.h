@@ -32,6 +32,7 @@ public:
 
   virtual void initialize();
   virtual void execute();
+  virtual void deferReductions();
   virtual Real getValue();
   virtual void threadJoin(const UserObject & y);
 
@@ -35,6 +35,7 @@ public:
   /**
    * This will return the degrees of freedom in the system.
    */
+  virtual void deferReductions();
   virtual Real getValue();
 
   void threadJoin(const UserObject & y);
@@ -19,8 +19,13 @@
 
 #include <string>
 #include <list>
+#include <map>
+#include <vector>
+#include <utility>
+#include <stdint.h>
 
 class RestartableDatas;
+class RestartableDataValue;
 
 class FEProblem;
 
@@ -39,14 +44,36 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Store the restartable data in memory instead of writing it out.
+   * @param files The name and the contents of each file writeRestartableData() would write (appended to)
+   */
+  void serializeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::vector<std::pair<std::string, std::string> > & files);
+
   /**
    * Read the restartable data.
    */
   void readRestartableData(std::string base_file_name, RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * The name of the file holding the data of a thread on this processor.
+   */
+  static std::string fileName(const std::string & base_file_name, unsigned int tid);
+
 private:
+  /**
+   * Store the header and the values of a thread's restartable data.
+   *
+   * The values are streamed directly into the output after a table holding the offset and the size
+   * of each of them, so the stream has to be seekable.
+   */
+  void storeRestartableData(std::ostream & out, const std::map<std::string, RestartableDataValue *> & restartable_data);
+
   /// Reference to a FEProblem being restarted
   FEProblem & _fe_problem;
+
+  /// Version of the restartable data files
+  static const unsigned int file_version;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
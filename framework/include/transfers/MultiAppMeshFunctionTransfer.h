@@ -17,6 +17,10 @@
 
 #include "MultiAppTransfer.h"
 
+// libMesh includes
+#include "libmesh/mesh_tools.h"
+#include "libmesh/point_locator_base.h"
+
 class MooseVariable;
 class MultiAppMeshFunctionTransfer;
 
@@ -37,6 +41,24 @@ public:
   virtual void execute();
 
 protected:
+  /**
+   * Compute the bounding box of the elements owned by each processor in a single pass over the mesh.
+   * @param mesh The (serial) mesh
+   * @param boxes The bounding box of each processor (output, empty processors get an inverted box)
+   */
+  void getProcessorBoundingBoxes(const MeshBase & mesh, std::vector<MeshTools::BoundingBox> & boxes);
+
+  /**
+   * Evaluate a variable at a point from the locally owned part of the solution.
+   * @param p The point
+   * @param sys The system the variable lives in
+   * @param var_num The number of the variable in the system
+   * @param locator A point locator over the mesh of sys
+   * @param proc_id The id of this processor in the communicator of sys
+   * @return The value or NOTFOUND if the point is not in an element owned by this processor
+   */
+  Real evaluateLocal(const Point & p, System & sys, unsigned int var_num, const PointLocatorBase & locator, processor_id_type proc_id);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
@@ -16,6 +16,7 @@
 #define MULTIAPPNEARESTNODETRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 class MooseVariable;
 class MultiAppNearestNodeTransfer;
@@ -37,14 +38,24 @@ public:
 
 protected:
   /**
-   * Return the nearest node to the point p.
-   * @param p The point you want to find the nearest node to.
-   * @param distance This will hold the distance between the returned node and p
+   * Build a KDTree over a range of nodes.
    * @param nodes_begin - iterator to the beginning of the node list
    * @param nodes_end - iterator to the end of the node list
-   * @return The Node closest to point p.
+   * @param nodes The nodes the indices of the tree refer to (output)
+   * @param tree The tree (output)
    */
-  Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
+  void buildNodeTree(const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end, std::vector<Node *> & nodes, KDTree & tree);
+
+  /**
+   * Find the nearest node to each of the points (threaded).  Uses and fills the caches when _fixed_meshes is set.
+   * @param points The points you want to find the nearest nodes to.
+   * @param ids The ids of the target nodes / elements the points belong to (used for caching)
+   * @param nodes The nodes of the tree as returned by buildNodeTree()
+   * @param tree The tree to search
+   * @param nearest The Node closest to each point (NULL if there are no nodes)
+   * @param distances This will hold the distance between the nearest node and each point
+   */
+  void getNearestNodes(const std::vector<Point> & points, const std::vector<dof_id_type> & ids, const std::vector<Node *> & nodes, const KDTree & tree, std::vector<Node *> & nearest, std::vector<Real> & distances);
 
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
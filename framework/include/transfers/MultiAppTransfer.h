@@ -19,6 +19,9 @@
 #include "MultiApp.h"
 #include "MooseEnum.h"
 
+// libMesh includes
+#include "libmesh/parallel.h"
+
 class MultiAppTransfer;
 
 template<>
@@ -59,6 +62,17 @@ public:
   virtual int executeOn() { return _multi_app->executeOn(); }
 
 protected:
+  /**
+   * Send a batch of data to every processor of the master communicator and receive theirs.
+   * Only the message sizes go through a collective, the data itself is exchanged with
+   * nonblocking point to point messages so a processor only talks to the ones it has data for.
+   * @param outgoing The data to send to each processor (indexed by processor id)
+   * @param incoming The data received from each processor (output, indexed by processor id)
+   * @param tag The tag used for the messages
+   */
+  template<typename T>
+  void exchangeData(std::vector<std::vector<T> > & outgoing, std::vector<std::vector<T> > & incoming, int tag);
+
   /// The MultiApp this Transfer is transferring data to or from
   MultiApp * _multi_app;
 
@@ -66,4 +80,46 @@ protected:
   MooseEnum _direction;
 };
 
+template<typename T>
+void
+MultiAppTransfer::exchangeData(std::vector<std::vector<T> > & outgoing, std::vector<std::vector<T> > & incoming, int tag)
+{
+  processor_id_type n_procs = libMesh::n_processors();
+  processor_id_type proc_id = libMesh::processor_id();
+
+  mooseAssert(outgoing.size() == n_procs, "There must be one outgoing buffer per processor");
+
+  std::vector<unsigned int> n_incoming(n_procs);
+  for (processor_id_type p = 0; p < n_procs; ++p)
+    n_incoming[p] = outgoing[p].size();
+
+  Parallel::alltoall(n_incoming);
+
+  incoming.clear();
+  incoming.resize(n_procs);
+  incoming[proc_id] = outgoing[proc_id];
+
+  Parallel::MessageTag comm_tag(tag);
+  // The requests must not move while they are pending
+  std::vector<Parallel::Request> requests;
+  requests.reserve(2*n_procs);
+
+  for (processor_id_type p = 0; p < n_procs; ++p)
+    if (p != proc_id && n_incoming[p] > 0)
+    {
+      incoming[p].resize(n_incoming[p]);
+      requests.push_back(Parallel::Request());
+      Parallel::receive(p, incoming[p], requests.back(), comm_tag);
+    }
+
+  for (processor_id_type p = 0; p < n_procs; ++p)
+    if (p != proc_id && outgoing[p].size() > 0)
+    {
+      requests.push_back(Parallel::Request());
+      Parallel::send(p, outgoing[p], requests.back(), comm_tag);
+    }
+
+  Parallel::wait(requests);
+}
+
 #endif /* MULTIAPPTRANSFER_H */
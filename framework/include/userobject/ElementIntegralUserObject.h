@@ -37,6 +37,7 @@ public:
   virtual void initialize();
   virtual void execute();
   virtual void threadJoin(const UserObject & y);
+  virtual void deferReductions();
   virtual Real getValue();
 
   virtual void finalize(){}
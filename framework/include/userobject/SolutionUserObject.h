@@ -16,7 +16,9 @@
 
 #include "GeneralUserObject.h"
 #include "libmesh/exodusII_io.h"
+#include "libmesh/fe_type.h"
 #include "MooseUtils.h"
+#include "MooseArray.h"
 
 // Forward Declarations
 namespace libMesh
@@ -25,6 +27,7 @@ namespace libMesh
   class EquationSystems;
   class System;
   class MeshFunction;
+  class PointLocatorBase;
   template<class T> class NumericVector;
 }
 
@@ -50,6 +53,9 @@ public:
 
   /**
    * Returns a value at a specific location and variable (see SolutionFunction)
+   *
+   * This searches the whole solution mesh for the point using the point locator of thread 0, callers
+   * evaluating many points (or from threads) should use the version taking a hint.
    * @param t The time at which to extract (not used, it is handled automatically when reading the data)
    * @param p The location at which to return a value
    * @param var_name The variable that is desired
@@ -57,6 +63,44 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const std::string & var_name) const;
 
+  /**
+   * Returns a value at a specific location and variable, starting the search for the element of the solution
+   * containing the point from the element found by the previous call
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param p The location at which to return a value
+   * @param var_name The variable that is desired
+   * @param elem_hint An element of the solution mesh to try first (may be NULL), upon return the element containing p
+   * @param tid The thread the call is made from
+   * @return The desired value for the given variable at a location
+   */
+  Real pointValue(Real t, const Point & p, const std::string & var_name, const Elem * & elem_hint, THREAD_ID tid) const;
+
+  /**
+   * Returns the values at several locations at once (e.g. all the qps of an element), see pointValue()
+   * @param values Upon return the value at each of the locations
+   */
+  void pointValues(Real t, const MooseArray<Point> & p, const std::string & var_name, std::vector<Real> & values, const Elem * & elem_hint, THREAD_ID tid) const;
+
+  /**
+   * When the mesh of the solution is the mesh of the simulation, returns the element of the solution matching an element
+   * of the simulation.  This is a perfect hint for pointValue().
+   * @param elem An element of the simulation mesh
+   * @return The matching element of the solution mesh or NULL if the meshes differ
+   */
+  const Elem * matchingElem(const Elem * elem) const;
+
+  /**
+   * @return True if the mesh of the solution is the mesh of the simulation (same nodes and elements with the same ids),
+   * so nodal values can be read directly from the dofs of the matching nodes
+   */
+  bool identicalMesh() const { return _identical_mesh; }
+
+  /**
+   * @param var_name The variable of the solution
+   * @return The finite element type the variable was read as (nodal variables of ExodusII files are first order)
+   */
+  const FEType & variableType(const std::string & var_name) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -135,6 +179,33 @@ protected:
    */
   Real evalMeshFunction(const Point & p, std::string var_name, unsigned int func_num) const;
 
+  /**
+   * Find the element of the solution containing a point
+   * @param p The location (in the frame of the solution mesh)
+   * @param elem_hint The element to try first (may be NULL)
+   * @param tid The thread the call is made from (each thread has its own point locator)
+   */
+  const Elem * findElem(const Point & p, const Elem * elem_hint, THREAD_ID tid) const;
+
+  /**
+   * Evaluate a single variable of the solution (interpolated in time if needed) at a point of an element
+   * @param p The location (in the frame of the solution mesh)
+   * @param elem The element of the solution containing p
+   * @param var_num The variable number
+   * @param dof_indices The dof indices of the variable on elem
+   */
+  Real evalElem(const Point & p, const Elem * elem, unsigned int var_num, const std::vector<dof_id_type> & dof_indices) const;
+
+  /**
+   * Apply the coordinate scale and factor to move a point of the simulation to the frame of the solution mesh
+   */
+  Point toSolutionFrame(const Point & p) const;
+
+  /**
+   * Check whether the mesh of the solution is the mesh of the simulation
+   */
+  bool checkIdenticalMesh() const;
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -210,6 +281,12 @@ protected:
   /// Factor parameter
   std::vector<Real> _factor;
 
+  /// A point locator on the solution mesh for each thread
+  std::vector<PointLocatorBase *> _point_locators;
+
+  /// True if the mesh of the solution is the mesh of the simulation
+  bool _identical_mesh;
+
 };
 
 #endif //SOLUTIONUSEROBJECT_H
@@ -55,6 +55,13 @@ public:
    */
   virtual void finalize() = 0;
 
+  /**
+   * Register the values that have to be reduced across processors with deferSum(), deferMax() and deferMin().
+   * Called after threadJoin() and before finalize(): the values of all of the objects finalized together
+   * are reduced in place with one allreduce per operation.
+   */
+  virtual void deferReductions() {}
+
   /**
    * Load user data object from a stream
    * @param stream Stream to load from
@@ -103,6 +110,15 @@ public:
     Parallel::min(value);
   }
 
+  /**
+   * Deferred versions of gatherSum(), gatherMax() and gatherMin(), to be called from deferReductions().
+   * The value holds the gathered value once finalize() is called.
+   */
+  void deferSum(Real & value);
+  void deferSum(std::vector<Real> & values);
+  void deferMax(Real & value);
+  void deferMin(Real & value);
+
   template <typename T1, typename T2>
   void gatherProxyValueMax(T1 & value, T2 & proxy)
   {
@@ -0,0 +1,100 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOUNDINGVOLUMEHIERARCHY_H
+#define BOUNDINGVOLUMEHIERARCHY_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+#include "libmesh/mesh_tools.h"
+
+// System includes
+#include <vector>
+
+/**
+ * A bounding volume hierarchy of axis aligned boxes (one per object, ie an element side).
+ *
+ * The hierarchy is built once by median splits of the box centers and can be refitted to
+ * moved boxes in O(N) without changing its topology.  Queries are always exact, a refit only
+ * makes them prune less when the objects moved a lot relative to each other.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+  /**
+   * @param leaf_size The maximum number of boxes stored in a leaf
+   */
+  BoundingVolumeHierarchy(unsigned int leaf_size = 4);
+
+  /**
+   * Build the hierarchy from scratch.  The indices returned by the queries refer to this vector.
+   */
+  void build(const std::vector<MeshTools::BoundingBox> & boxes);
+
+  /**
+   * Update the hierarchy for new boxes of the same objects (same size and order as in build()).
+   */
+  void refit(const std::vector<MeshTools::BoundingBox> & boxes);
+
+  /**
+   * Number of boxes in the hierarchy
+   */
+  unsigned int size() const { return _boxes.size(); }
+
+  /**
+   * Find all boxes containing p (in no particular order).
+   */
+  void containing(const Point & p, std::vector<unsigned int> & indices) const;
+
+  /**
+   * Find all boxes closer than distance to p (in no particular order).
+   */
+  void withinDistance(const Point & p, Real distance, std::vector<unsigned int> & indices) const;
+
+  /**
+   * Squared distance from p to a box (0 inside the box)
+   */
+  static Real distanceSquared(const MeshTools::BoundingBox & box, const Point & p);
+
+protected:
+  class TreeNode
+  {
+  public:
+    MeshTools::BoundingBox _box;
+    /// Range of boxes in _boxes / _indices below this node
+    unsigned int _begin;
+    unsigned int _end;
+    /// Children (libMesh::invalid_uint for leaves)
+    unsigned int _left;
+    unsigned int _right;
+  };
+
+  unsigned int buildNode(const std::vector<Point> & centers, unsigned int begin, unsigned int end);
+
+  /// Grow box to also contain other
+  static void merge(MeshTools::BoundingBox & box, const MeshTools::BoundingBox & other);
+
+  unsigned int _leaf_size;
+
+  /// Boxes in hierarchy order
+  std::vector<MeshTools::BoundingBox> _boxes;
+  /// Original index of each box in hierarchy order
+  std::vector<unsigned int> _indices;
+  /// Nodes in pre-order (the root is 0 and children always come after their parent)
+  std::vector<TreeNode> _nodes;
+};
+
+#endif // BOUNDINGVOLUMEHIERARCHY_H
@@ -0,0 +1,77 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DEFERREDREDUCTION_H
+#define DEFERREDREDUCTION_H
+
+#include "Moose.h"
+
+// System includes
+#include <vector>
+
+/**
+ * Collects values that need to be summed, maxed or minned across all processors and reduces
+ * them together: one packed allreduce per operation no matter how many values were registered.
+ *
+ * The registered values are reduced in place by reduce(), so they must stay alive until then.
+ */
+class DeferredReduction
+{
+public:
+  DeferredReduction();
+
+  /// Register a value to be summed over all processors
+  void sum(Real & value);
+
+  /// Register each entry of a vector to be summed over all processors (the size must be the same everywhere)
+  void sum(std::vector<Real> & values);
+
+  /// Register a value to be maxed over all processors
+  void max(Real & value);
+
+  /// Register a value to be minned over all processors
+  void min(Real & value);
+
+  /**
+   * Perform the reductions of everything registered since the last call and forget about it.
+   * Collective: every processor must call it with the same registrations in the same order.
+   */
+  void reduce();
+
+protected:
+  enum Operation
+  {
+    SUM,
+    MAX,
+    MIN
+  };
+
+  /**
+   * Pack the values, reduce them with a single collective and unpack the result.
+   * @param values The registered values
+   * @param op The reduction to perform
+   */
+  void reduce(std::vector<Real *> & values, Operation op);
+
+  /// The values to sum
+  std::vector<Real *> _sum_values;
+
+  /// The values to max
+  std::vector<Real *> _max_values;
+
+  /// The values to min
+  std::vector<Real *> _min_values;
+};
+
+#endif /* DEFERREDREDUCTION_H */
@@ -0,0 +1,81 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DOFINTERPOLATION_H
+#define DOFINTERPOLATION_H
+
+#include "MooseArray.h"
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// System includes
+#include <vector>
+
+/**
+ * Interpolation of the values of a variable on an element to its quadrature points, shared by
+ * MooseVariable::computeValues() and its unit test/benchmark.
+ */
+namespace DofInterpolation
+{
+  /**
+   * Copy the entries of a vector that belong to an element into a contiguous buffer
+   * @param dof_indices The dofs of the element
+   * @param vector Anything indexed with operator() (a NumericVector in MOOSE)
+   * @param dof_values The values at the dofs (output)
+   */
+  template<typename VectorType>
+  void gatherDofValues(const std::vector<dof_id_type> & dof_indices, const VectorType & vector, std::vector<Real> & dof_values)
+  {
+    unsigned int num_dofs = dof_indices.size();
+    dof_values.resize(num_dofs);
+
+    for (unsigned int i = 0; i < num_dofs; ++i)
+      dof_values[i] = vector(dof_indices[i]);
+  }
+
+  inline void addScaled(Real & value, Real phi, Real coeff) { value += phi * coeff; }
+
+  template<typename T>
+  inline void addScaled(T & value, const T & phi, Real coeff) { value.add_scaled(phi, coeff); }
+
+  /**
+   * Interpolate the gathered dof values to the quadrature points.  The dof loop is the outer one so that
+   * the inner loop is a plain axpy over contiguous shape function values, which the compiler can vectorize.
+   * @param phi The shape functions (or their derivatives) indexed by [dof][qp]
+   * @param dof_values The values gathered by gatherDofValues()
+   * @param values The values at the quadrature points (output)
+   * @param nqp The number of quadrature points
+   */
+  template<typename OutputType, typename PhiType>
+  void interpolateDofValues(const MooseArray<std::vector<PhiType> > & phi, const std::vector<Real> & dof_values, MooseArray<OutputType> & values, unsigned int nqp)
+  {
+    values.resize(nqp);
+    for (unsigned int qp = 0; qp < nqp; ++qp)
+      values[qp] = 0;
+
+    unsigned int num_dofs = dof_values.size();
+    for (unsigned int i = 0; i < num_dofs; ++i)
+    {
+      const std::vector<PhiType> & phi_i = phi[i];
+      const Real coeff = dof_values[i];
+
+      for (unsigned int qp = 0; qp < nqp; ++qp)
+        addScaled(values[qp], phi_i[qp], coeff);
+    }
+  }
+}
+
+#endif //DOFINTERPOLATION_H
@@ -23,6 +23,7 @@
 #include "libmesh/exodusII_io.h"
 
 #include <string>
+#include <vector>
 #include <map>
 #include <set>
 #include <ostream>
@@ -62,7 +63,31 @@ public:
 
   void clear();
 
-  const std::map<Real, std::map<std::string, Real> > & getData() const { return _data; }
+  /**
+   * Only keep the most recent rows in memory.  The table then grows at most to twice this size,
+   * the older rows are dropped (and only counted).  Such a table can only be printed to screen.
+   * @param n_rows The number of rows to keep, 0 to keep everything (the default)
+   */
+  void setWindow(unsigned int n_rows);
+
+  /// The number of rows in memory
+  unsigned int numRows() const { return _times.size(); }
+
+  /// The time of a row
+  Real getTime(unsigned int row) const { return _times[row]; }
+
+  /**
+   * Find the row of a time, searching from the most recent one
+   * @param time The time to look for
+   * @param rel_tol The relative tolerance (absolute if time is zero)
+   * @return The index of the row, libMesh::invalid_uint if there is none
+   */
+  unsigned int findRow(Real time, Real rel_tol) const;
+
+  /**
+   * Retrieve all the values of a row (in column name order)
+   */
+  void getRow(unsigned int row, std::vector<std::string> & names, std::vector<Real> & values) const;
 
   /**
    * Methods for dumping the table to the stream - either by filename or by stream handle.  If
@@ -75,7 +100,9 @@ public:
   void printTable(const std::string & file_name);
 
   /**
-   * Method for dumping the table to a csv file - opening and closing the file handle is handled
+   * Method for dumping the table to a csv file - opening and closing the file handle is handled.
+   * Only the rows added since the last call are appended, the file is rewritten only when columns
+   * were added or rows that were already written changed.
    */
   void printCSV(const std::string & file_name, int interval=1);
 
@@ -105,15 +132,42 @@ protected:
   unsigned short getTermWidth(bool use_environment) const;
 
   /**
-   * Data structure for the console table
-   * The first map creates an association from the independent variable (normally time)
-   * to a map of dependent variables and their associated values if they exist
+   * Find or insert the row of a time (the rows are sorted by time)
    */
-  std::map<Real, std::map<std::string, Real> > _data;
+  unsigned int getRowIndex(Real time);
+
+  /**
+   * Write a row to the csv file
+   */
+  void printCSVRow(unsigned int row);
+
+  /// The independent variable (normally time) of each row, sorted
+  std::vector<Real> _times;
+
+  /// The values of each column, one per row (zero where no value was added)
+  std::map<std::string, std::vector<Real> > _columns;
 
   /// The set of column names updated when data is inserted through the setter methods
   std::set<std::string> _column_names;
 
+  /// The number of rows kept in memory (0 for all of them)
+  unsigned int _window;
+
+  /// The number of rows dropped because of the window
+  unsigned int _n_dropped;
+
+  /// The number of rows already written to the csv file
+  unsigned int _csv_rows;
+
+  /// The number of columns in the header of the csv file
+  unsigned int _csv_columns;
+
+  /// The first row changed since the csv file was written
+  unsigned int _first_changed_row;
+
+  /// The end of the last row in the csv file (the file ends with an empty line after it)
+  std::streampos _csv_end;
+
   /// The single cell width used for all columns in the table
   static const unsigned short _column_width;
 
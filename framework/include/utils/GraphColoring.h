@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GRAPHCOLORING_H
+#define GRAPHCOLORING_H
+
+// System includes
+#include <vector>
+
+/**
+ * Column colorings of sparse matrices for computing Jacobians by finite differences.
+ *
+ * Two columns may share a color only if no row has a nonzero in both of them (a distance-2
+ * coloring of the bipartite row/column graph), so every color costs one residual evaluation.
+ */
+namespace GraphColoring
+{
+  /**
+   * Greedily color the columns of a sparse matrix.
+   * @param rows The column indices of the nonzeros of every row
+   * @param n_cols The number of columns
+   * @param smallest_last Color the columns in smallest-last order instead of in index order.
+   *        It usually needs fewer colors but has to build the column intersection graph.
+   * @param colors The color of every column (output)
+   * @return The number of colors
+   */
+  unsigned int colorColumns(const std::vector<std::vector<unsigned int> > & rows,
+                            unsigned int n_cols,
+                            bool smallest_last,
+                            std::vector<unsigned int> & colors);
+}
+
+#endif //GRAPHCOLORING_H
@@ -0,0 +1,118 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+#include <utility>
+
+/**
+ * A k-d tree over a set of points answering exact nearest neighbor queries in O(log N).
+ *
+ * Every node of the tree stores the bounding box of its points so the tree can be refitted
+ * to moved points in O(N) without changing its topology.  Queries stay exact after a refit,
+ * they just prune less when the points moved a lot relative to each other.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param leaf_size The maximum number of points stored in a leaf
+   */
+  KDTree(unsigned int leaf_size = 8);
+
+  /**
+   * Build the tree from scratch.  The indices returned by the queries refer to this vector.
+   */
+  void build(const std::vector<Point> & points);
+
+  /**
+   * Update the tree for new positions of the same points (same size and order as in build()).
+   */
+  void refit(const std::vector<Point> & points);
+
+  /**
+   * Number of points in the tree
+   */
+  unsigned int size() const { return _points.size(); }
+
+  /**
+   * Find the point closest to p.
+   * @param p The query point
+   * @param distance The distance to the closest point (output)
+   * @return The index of the closest point (the lowest one if several are equally close)
+   *         or libMesh::invalid_uint if the tree is empty
+   */
+  unsigned int nearest(const Point & p, Real & distance) const;
+
+  /**
+   * Find the point closest to each of a batch of points.  The queries are split between threads.
+   * @param points The query points
+   * @param indices The index of the closest point for each query point (libMesh::invalid_uint if the tree is empty)
+   * @param distances The distance to the closest point for each query point
+   */
+  void nearest(const std::vector<Point> & points, std::vector<unsigned int> & indices, std::vector<Real> & distances) const;
+
+  /**
+   * Find the k points closest to p sorted by increasing distance (fewer if the tree has less than k points).
+   */
+  void nearest(const Point & p, unsigned int k, std::vector<unsigned int> & indices) const;
+
+  /**
+   * Find all points within radius of p (in no particular order).
+   */
+  void withinRadius(const Point & p, Real radius, std::vector<unsigned int> & indices) const;
+
+protected:
+  class TreeNode
+  {
+  public:
+    Point _min;
+    Point _max;
+    /// Range of points in _points / _indices below this node
+    unsigned int _begin;
+    unsigned int _end;
+    /// Children (libMesh::invalid_uint for leaves)
+    unsigned int _left;
+    unsigned int _right;
+  };
+
+  unsigned int buildNode(unsigned int begin, unsigned int end);
+  void computeBox(TreeNode & node) const;
+
+  /// Squared distance from p to the bounding box of a node
+  Real boxDistanceSquared(const TreeNode & node, const Point & p) const;
+
+  void nearestRecurse(unsigned int node_id, const Point & p, unsigned int & best, Real & best_dist_sq) const;
+  void nearestRecurse(unsigned int node_id, const Point & p, unsigned int k, std::vector<std::pair<Real, unsigned int> > & heap) const;
+  void radiusRecurse(unsigned int node_id, const Point & p, Real radius_sq, std::vector<unsigned int> & indices) const;
+
+  unsigned int _leaf_size;
+
+  /// Points in tree order
+  std::vector<Point> _points;
+  /// Original index of each point in tree order
+  std::vector<unsigned int> _indices;
+  /// Nodes in pre-order (the root is 0 and children always come after their parent)
+  std::vector<TreeNode> _nodes;
+};
+
+#endif // KDTREE_H
@@ -149,6 +149,16 @@ enum SolveType
   ST_LINEAR            ///< Solving a linear problem
 };
 
+/**
+ * How the columns of the finite differenced preconditioner are colored
+ */
+enum FDColoringType
+{
+  FDC_JACOBIAN,        ///< Assemble the analytic Jacobian to get the nonzero pattern and use PETSc's LF coloring
+  FDC_GREEDY,          ///< Distance-2 greedy coloring of the DofMap sparsity graph in dof order
+  FDC_SMALLEST_LAST    ///< Distance-2 greedy coloring of the DofMap sparsity graph in smallest-last order
+};
+
 /**
  * Type of the line search
  */
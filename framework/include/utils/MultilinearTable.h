@@ -0,0 +1,92 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MULTILINEARTABLE_H
+#define MULTILINEARTABLE_H
+
+#include "Moose.h"
+
+#include <vector>
+
+/**
+ * Multilinear interpolation of a function tabulated on a grid of up to 4 dimensions
+ *
+ * The values are stored flat with the first axis varying fastest (the GriddedData ordering).
+ * Points outside of the grid get the value at the closest end of each axis.
+ *
+ * Lookups do not allocate: the strides are precomputed and the interval search starts from the
+ * intervals found by the previous lookup (kept by the caller in a Cache), so evaluating nearby
+ * points one after the other (e.g. the qps of an element) is O(1) per axis.
+ */
+class MultilinearTable
+{
+public:
+  static const unsigned int MAX_DIM = 4;
+
+  /**
+   * Intervals found along each axis by the last lookup.  Every thread/caller needs its own.
+   */
+  struct Cache
+  {
+    Cache()
+    {
+      for (unsigned int i = 0; i < MAX_DIM; ++i)
+        _interval[i] = 0;
+    }
+
+    unsigned int _interval[MAX_DIM];
+  };
+
+  /**
+   * @param grid The grid points along each axis (monotonically increasing)
+   * @param fcn The function values at the grid points, f[i,j,k,l] is fcn[i + j*Ni + k*Ni*Nj + l*Ni*Nj*Nk]
+   */
+  MultilinearTable(const std::vector<std::vector<Real> > & grid, const std::vector<Real> & fcn);
+
+  /**
+   * @return The number of axes of the grid
+   */
+  unsigned int dim() const { return _dim; }
+
+  /**
+   * Interpolate the table at a point
+   * @param pt The coordinates of the point along each axis (dim() values)
+   * @param cache The intervals of the previous lookup, updated with the ones of pt
+   */
+  Real sample(const Real * pt, Cache & cache) const;
+
+protected:
+  /**
+   * Find the interval of an axis containing x with a hunt search starting from interval
+   * @param axis The axis to search
+   * @param x The coordinate along the axis
+   * @param interval The interval to start from, upon return the interval containing x
+   * @param fraction Upon return the position of x in the interval (0 at its left end, 1 at its right end)
+   */
+  void locate(unsigned int axis, Real x, unsigned int & interval, Real & fraction) const;
+
+  /// Number of axes
+  unsigned int _dim;
+
+  /// The grid points along each axis
+  std::vector<std::vector<Real> > _grid;
+
+  /// The function values
+  std::vector<Real> _fcn;
+
+  /// Distance in _fcn between neighboring points along each axis (0 for axes holding a single point)
+  unsigned int _stride[MAX_DIM];
+};
+
+#endif //MULTILINEARTABLE_H
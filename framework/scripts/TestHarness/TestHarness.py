@@ -50,6 +50,8 @@ class TestHarness:
     self.checks['unique_ids'] = getLibMeshConfigOption(self.libmesh_dir, 'unique_ids')
     self.checks['vtk'] =  getLibMeshConfigOption(self.libmesh_dir, 'vtk')
     self.checks['tecplot'] =  getLibMeshConfigOption(self.libmesh_dir, 'tecplot')
+    self.checks['tbb'] =  getLibMeshConfigOption(self.libmesh_dir, 'tbb')
+    self.checks['petsc_threadsafety'] = getPetscThreadSafety()
 
     # Override the MESH_MODE option if using '--parallel-mesh' option
     if self.options.parallel_mesh == True or \
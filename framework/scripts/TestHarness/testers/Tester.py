@@ -30,6 +30,8 @@ class Tester(object):
     params.addParam('recover',       True,    "A test that runs with '--recover' mode enabled")
     params.addParam('vtk',           ['ALL'], "A test that runs only if VTK is detected ('ALL', 'TRUE', 'FALSE')")
     params.addParam('tecplot',       ['ALL'], "A test that runs only if Tecplot is detected ('ALL', 'TRUE', 'FALSE')")
+    params.addParam('tbb',           ['ALL'], "A test that runs only if libMesh threads use TBB ('ALL', 'TRUE', 'FALSE')")
+    params.addParam('petsc_threadsafety', ['ALL'], "A test that runs only if PETSc is configured --with-threadsafety ('ALL', 'TRUE', 'FALSE')")
 
     return params
   getValidParams = staticmethod(getValidParams)
@@ -131,7 +133,7 @@ class Tester(object):
       return (False, reason)
 
     # PETSc is being explicitly checked above
-    local_checks = ['platform', 'compiler', 'mesh_mode', 'method', 'library_mode', 'dtk', 'unique_ids', 'vtk', 'tecplot']
+    local_checks = ['platform', 'compiler', 'mesh_mode', 'method', 'library_mode', 'dtk', 'unique_ids', 'vtk', 'tecplot', 'tbb', 'petsc_threadsafety']
     for check in local_checks:
       test_platforms = set()
       for x in self.specs[check]:
@@ -37,6 +37,14 @@ LIBMESH_OPTIONS = {
       'FALSE' : '0'
       }
                      },
+  'tbb' :          { 're_option' : r'#define\s+LIBMESH_HAVE_TBB_API\s+(\d+)',
+                     'default'   : 'FALSE',
+                     'options'   :
+                       {
+      'TRUE'  : '1',
+      'FALSE' : '0'
+      }
+                     },
   'tecplot' :      { 're_option' : r'#define\s+LIBMESH_HAVE_TECPLOT_API\s+(\d+)',
                      'default'   : 'FALSE',
                      'options'   :
@@ -283,6 +291,37 @@ def getPetscVersion(libmesh_dir):
 
   return petsc_version
 
+def getPetscThreadSafety():
+  # PETSc configured --with-threadsafety defines PETSC_HAVE_THREADSAFETY in petscconf.h,
+  # found in $PETSC_DIR/include or $PETSC_DIR/$PETSC_ARCH/include
+  option_set = set()
+  option_set.add('ALL')
+
+  petsc_dir = os.environ.get('PETSC_DIR', '')
+  petsc_arch = os.environ.get('PETSC_ARCH', '')
+
+  filenames = [
+    os.path.join(petsc_dir, 'include', 'petscconf.h'),
+    os.path.join(petsc_dir, petsc_arch, 'include', 'petscconf.h')
+    ]
+
+  for filename in filenames:
+    try:
+      f = open(filename)
+      contents = f.read()
+      f.close()
+    except IOError, e:
+      continue
+
+    if re.search(r'#define\s+PETSC_HAVE_THREADSAFETY\s+1', contents):
+      option_set.add('TRUE')
+    else:
+      option_set.add('FALSE')
+    return option_set
+
+  option_set.add('FALSE')
+  return option_set
+
 # Break down petsc version logic in a new define
 # TODO: find a way to eval() logic instead
 def checkPetscVersion(checks, test):
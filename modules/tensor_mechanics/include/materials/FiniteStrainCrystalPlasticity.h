@@ -6,6 +6,7 @@
 #include "FiniteStrainMaterial.h"
 
 class FiniteStrainCrystalPlasticity;
+class CrystalPlasticityOrientationStore;
 
 template<>
 InputParameters validParams<FiniteStrainCrystalPlasticity>();
@@ -72,6 +73,25 @@ protected:
   MaterialProperty<RankTwoTensor> & _crysrot;
   MaterialProperty<RankTwoTensor> & _crysrot_old;
 
+  /// Shared slip systems and crystal rotations, if the input provides a store
+  const CrystalPlasticityOrientationStore * _orientation_store;
+
+  /// Normalized slip directions and normals, from the store or read once by this material
+  const std::vector<Real> * _slip_dir;
+  const std::vector<Real> * _slip_normal;
+
+  /// Crystal rotation from the euler_angle_1/2/3 parameters
+  RankTwoTensor _default_crysrot;
+
+  /// Crystal rotation of the current element, set by get_euler_ang()
+  const RankTwoTensor * _elem_crysrot;
+
+  /// File data read by this material when no store is given
+  std::vector<Real> _own_slip_dir;
+  std::vector<Real> _own_slip_normal;
+  std::vector<RankTwoTensor> _own_rotations;
+  std::vector<char> _own_has_rotation;
+
 
 
 private:
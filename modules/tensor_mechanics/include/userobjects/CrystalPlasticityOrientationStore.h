@@ -0,0 +1,72 @@
+#ifndef CRYSTALPLASTICITYORIENTATIONSTORE_H
+#define CRYSTALPLASTICITYORIENTATIONSTORE_H
+
+#include "GeneralUserObject.h"
+#include "RankTwoTensor.h"
+
+class CrystalPlasticityOrientationStore;
+
+template<>
+InputParameters validParams<CrystalPlasticityOrientationStore>();
+
+/**
+ * Reads the slip system and Euler angle files used by FiniteStrainCrystalPlasticity
+ * once and holds them for every material that refers to it.
+ *
+ * The slip directions and normals are stored normalized, and the Euler angles are
+ * stored as crystal rotation matrices indexed by element id.  Only the thread 0 copy
+ * (the one handed out by getUserObject) parses the files; the data is read-only
+ * afterwards, so it can be shared by all threads.
+ */
+class CrystalPlasticityOrientationStore : public GeneralUserObject
+{
+public:
+  CrystalPlasticityOrientationStore(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+  virtual void finalize() {}
+
+  /// Number of slip systems read from the slip system file
+  unsigned int numSlipSystems() const { return _nss; }
+
+  /// Normalized slip directions, three components per slip system
+  const std::vector<Real> & slipDirections() const { return _slip_dir; }
+
+  /// Normalized slip plane normals, three components per slip system
+  const std::vector<Real> & slipNormals() const { return _slip_normal; }
+
+  /**
+   * The crystal rotation of the element with the given id, or NULL if the
+   * Euler angle file has no entry for it.
+   */
+  const RankTwoTensor * crystalRotation(dof_id_type elem_id) const;
+
+  /**
+   * Reads nss slip plane normals followed by nss slip directions from file_name
+   * and normalizes them.
+   */
+  static void readSlipSystems(const std::string & file_name, unsigned int nss,
+                              std::vector<Real> & slip_dir, std::vector<Real> & slip_normal);
+
+  /**
+   * Reads "elem_no phi1 phi phi2" lines from file_name (elem_no is one-based) into
+   * rotation matrices indexed by element id.  The first entry for an element wins.
+   */
+  static void readEulerAngles(const std::string & file_name,
+                              std::vector<RankTwoTensor> & rotations, std::vector<char> & has_rotation);
+
+  /// The crystal rotation for the Bunge Euler angles (in degrees)
+  static RankTwoTensor eulerRotation(Real phi1, Real phi, Real phi2);
+
+protected:
+  const unsigned int _nss;
+
+  std::vector<Real> _slip_dir;
+  std::vector<Real> _slip_normal;
+
+  std::vector<RankTwoTensor> _rotations;
+  std::vector<char> _has_rotation;
+};
+
+#endif //CRYSTALPLASTICITYORIENTATIONSTORE_H
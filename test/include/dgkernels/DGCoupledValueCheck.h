@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DGCOUPLEDVALUECHECK_H
+#define DGCOUPLEDVALUECHECK_H
+
+#include "DGKernel.h"
+
+//Forward Declarations
+class DGCoupledValueCheck;
+
+template<>
+InputParameters validParams<DGCoupledValueCheck>();
+
+/**
+ * DG kernel that does not contribute to the residual, but errors out as soon as it is evaluated
+ * with a coupled value different from the expected one.  Used to check when DG kernels are active
+ * and that the variables they couple to are available.
+ */
+class DGCoupledValueCheck : public DGKernel
+{
+public:
+  DGCoupledValueCheck(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual Real computeQpResidual(Moose::DGResidualType type);
+  virtual Real computeQpJacobian(Moose::DGJacobianType type);
+
+  VariableValue & _v;
+  Real _value;
+};
+
+#endif
@@ -0,0 +1,44 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef RESTARTABLEDATABENCH_H
+#define RESTARTABLEDATABENCH_H
+
+#include "GeneralUserObject.h"
+
+class RestartableDataBench;
+
+template<>
+InputParameters validParams<RestartableDataBench>();
+
+/**
+ * User Object holding a large restartable vector for timing the checkpoint write and the restart read
+ */
+class RestartableDataBench : public GeneralUserObject
+{
+public:
+  RestartableDataBench(const std::string & name, InputParameters params);
+
+  virtual void initialize() {};
+  virtual void execute();
+  virtual void finalize() {};
+
+protected:
+  bool _check;
+  std::vector<Real> & _data;
+  std::vector<Real> & _recoverable_data;
+};
+
+
+#endif /* RESTARTABLEDATABENCH_H */
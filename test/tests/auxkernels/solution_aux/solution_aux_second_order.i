@@ -0,0 +1,84 @@
+# The mesh is the one the solution was written on, but the first order solution has no dofs
+# on the mid-side nodes of the second order aux variable, so its values are interpolated
+[Mesh]
+  file = solution_aux_second_order_gen_out.e
+  # See solution_aux_exodus.i
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./linear]
+    order = SECOND
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./linear_func]
+    type = ParsedFunction
+    value = 'x+2*y'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./linear]
+    type = SolutionAux
+    solution = soln
+    variable = linear
+  [../]
+[]
+
+[UserObjects]
+  [./soln]
+    type = SolutionUserObject
+    mesh = solution_aux_second_order_gen_out.e
+    nodal_variables = linear
+    timestep = 1
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./error]
+    type = NodalL2Error
+    variable = linear
+    function = linear_func
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  output_initial = false
+  csv = true
+[]
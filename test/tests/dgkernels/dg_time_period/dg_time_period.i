@@ -0,0 +1,85 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+    order = CONSTANT
+    family = MONOMIAL
+
+    [./InitialCondition]
+      type = ConstantIC
+      value = 2
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[DGKernels]
+  # Only evaluated in the second time period, and nothing else couples to v
+  [./check]
+    type = DGCoupledValueCheck
+    variable = u
+    v = v
+    value = 2
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  start_time = 0
+  dt = 0.5
+  num_steps = 2
+
+  [./TimePeriods]
+    [./first_period]
+      start = 0.0
+      inactive_dgkernels = 'check'
+    [../]
+
+    [./second_period]
+      start = 0.75
+      active_dgkernels = 'check'
+    [../]
+  [../]
+[]
+
+[Outputs]
+  console = true
+[]
@@ -0,0 +1,68 @@
+# Times the evaluation of a PiecewiseMultilinear function at every qp through a material
+# (compare the Material timings of the perf log between revisions)
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 60
+  ny = 60
+  nz = 60
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = diffusivity
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Functions]
+  [./diffusivity_fcn]
+    type = PiecewiseMultilinear
+    data_file = bench3D.txt
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = GenericFunctionMaterial
+    block = 0
+    prop_names = diffusivity
+    prop_values = diffusivity_fcn
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
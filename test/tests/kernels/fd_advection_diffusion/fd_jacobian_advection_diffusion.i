@@ -0,0 +1,91 @@
+# Same problem as fd_advection_diffusion.i built from regular Kernels whose
+# Jacobians are computed by perturbing the element degrees of freedom
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  uniform_refine = 1
+[]
+
+[Variables]
+  [./diffusing_advected]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  [./diffusing]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./diffuse_diffusing_advected]
+    type = Diffusion
+    variable = diffusing_advected
+    fd_jacobian = true
+  [../]
+
+  [./advect_diffusing_advected]
+    type = CoupledConvection
+    variable = diffusing_advected
+    velocity_vector = diffusing
+    fd_jacobian = true
+  [../]
+
+  [./diffuse_diffusing]
+    type = Diffusion
+    variable = diffusing
+  [../]
+[]
+
+[BCs]
+  [./bottom_diffusing_advected]
+    type = DirichletBC
+    variable = diffusing_advected
+    boundary = 'bottom'
+    value = 1
+  [../]
+
+  [./top_diffusing_advected]
+    type = DirichletBC
+    variable = diffusing_advected
+    boundary = 'top'
+    value = 0
+  [../]
+
+  [./bottom_diffusing]
+    type = DirichletBC
+    variable = diffusing
+    boundary = 'bottom'
+    value = 2
+  [../]
+
+  [./top_diffusing]
+    type = DirichletBC
+    variable = diffusing
+    boundary = 'top'
+    value = 0
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  file_base = fd_advection_diffusion_out
+  exodus = true
+  console = true
+[]
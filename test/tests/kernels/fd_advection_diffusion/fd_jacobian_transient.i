@@ -0,0 +1,112 @@
+# Transient advection diffusion whose Kernels, including the time derivatives,
+# compute their Jacobians by perturbing the element degrees of freedom
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./diffusing_advected]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  [./diffusing]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Functions]
+  [./diffusing_advected_func]
+    type = ParsedFunction
+    value = x*y
+  [../]
+
+  [./diffusing_func]
+    type = ParsedFunction
+    value = 1+x
+  [../]
+[]
+
+[ICs]
+  [./diffusing_advected_ic]
+    type = FunctionIC
+    variable = diffusing_advected
+    function = diffusing_advected_func
+  [../]
+
+  [./diffusing_ic]
+    type = FunctionIC
+    variable = diffusing
+    function = diffusing_func
+  [../]
+[]
+
+[Kernels]
+  [./time_diffusing_advected]
+    type = TimeDerivative
+    variable = diffusing_advected
+    fd_jacobian = true
+  [../]
+
+  [./diffuse_diffusing_advected]
+    type = Diffusion
+    variable = diffusing_advected
+    fd_jacobian = true
+  [../]
+
+  [./advect_diffusing_advected]
+    type = CoupledConvection
+    variable = diffusing_advected
+    velocity_vector = diffusing
+    fd_jacobian = true
+  [../]
+
+  [./time_diffusing]
+    type = TimeDerivative
+    variable = diffusing
+    fd_jacobian = true
+  [../]
+
+  [./diffuse_diffusing]
+    type = Diffusion
+    variable = diffusing
+  [../]
+[]
+
+[BCs]
+  [./bottom_diffusing_advected]
+    type = DirichletBC
+    variable = diffusing_advected
+    boundary = 'bottom'
+    value = 1
+  [../]
+
+  [./top_diffusing]
+    type = DirichletBC
+    variable = diffusing
+    boundary = 'top'
+    value = 0
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  num_steps = 1
+  dt = 0.1
+[]
+
+[Outputs]
+  console = true
+[]
@@ -0,0 +1,63 @@
+# Jacobian assembly benchmark: run with increasing --n-threads and compare
+# the jacobian_assembly_colored() and jacobian_assembly_locked() entries of the
+# perf log (the first assembly always takes the locked path).  The coloring
+# cost is reported as buildColoredElementRanges().
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 40
+  ny = 40
+  nz = 40
+[]
+
+[Problem]
+  colored_jacobian = true
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1
+
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'jacobi'
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
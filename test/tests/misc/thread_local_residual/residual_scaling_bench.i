@@ -0,0 +1,63 @@
+# Residual assembly scaling benchmark: run with increasing --n-threads and
+# compare the ComputeResidualThread and addAccumulatedResiduals() entries of
+# the perf log with Problem/thread_local_residual=false (the locked path).
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 60
+  ny = 60
+  nz = 60
+[]
+
+[Problem]
+  thread_local_residual = true
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./reaction]
+    type = Reaction
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  solve_type = 'JFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'jacobi'
+
+  l_max_its = 50
+  nl_max_its = 1
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = true
+  [../]
+[]
@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BOUNDINGVOLUMEHIERARCHYTEST_H
+#define BOUNDINGVOLUMEHIERARCHYTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "BoundingVolumeHierarchy.h"
+
+class BoundingVolumeHierarchyTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( BoundingVolumeHierarchyTest );
+
+  CPPUNIT_TEST( containingTest );
+  CPPUNIT_TEST( withinDistanceTest );
+  CPPUNIT_TEST( refitTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  BoundingVolumeHierarchyTest();
+  ~BoundingVolumeHierarchyTest();
+
+  void containingTest();
+  void withinDistanceTest();
+  void refitTest();
+
+private:
+  /// Compare the hierarchy against checking every box
+  void checkQueries(const BoundingVolumeHierarchy & bvh, const std::vector<MeshTools::BoundingBox> & boxes, Real distance);
+
+  std::vector<MeshTools::BoundingBox> _boxes;
+  std::vector<Point> _queries;
+};
+
+#endif  // BOUNDINGVOLUMEHIERARCHYTEST_H
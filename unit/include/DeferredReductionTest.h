@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DEFERREDREDUCTIONTEST_H
+#define DEFERREDREDUCTIONTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "DeferredReduction.h"
+
+class DeferredReductionTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( DeferredReductionTest );
+
+  CPPUNIT_TEST( reduceTest );
+  CPPUNIT_TEST( clearTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void reduceTest();
+  void clearTest();
+};
+
+#endif  // DEFERREDREDUCTIONTEST_H
@@ -0,0 +1,99 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef DOFINTERPOLATIONTEST_H
+#define DOFINTERPOLATIONTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "DofInterpolation.h"
+
+// libMesh includes
+#include "libmesh/dense_vector.h"
+#include "libmesh/vector_value.h"
+
+/**
+ * Checks the batched interpolation of MooseVariable against the fused per-dof loop it replaced
+ * and times both of them (old path vs new path) for HEX8 and HEX27 elements with 1 to 10 variables.
+ */
+class DofInterpolationTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( DofInterpolationTest );
+
+  CPPUNIT_TEST( hex8Test );
+  CPPUNIT_TEST( hex27Test );
+  CPPUNIT_TEST( benchmark );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void hex8Test();
+  void hex27Test();
+  void benchmark();
+
+private:
+  /**
+   * The values a transient nonlinear variable needs (u, grad_u, u_dot, du_dot_du, u_old) at the quadrature points
+   */
+  struct QpValues
+  {
+    MooseArray<Real> _u;
+    MooseArray<RealGradient> _grad_u;
+    MooseArray<Real> _u_dot;
+    MooseArray<Real> _du_dot_du;
+    MooseArray<Real> _u_old;
+
+    void release();
+  };
+
+  /**
+   * Shape functions and solution vectors of one element type
+   */
+  struct ElementData
+  {
+    ElementData(unsigned int n_dofs, unsigned int n_qp);
+    ~ElementData();
+
+    unsigned int _n_qp;
+    MooseArray<std::vector<Real> > _phi;
+    MooseArray<std::vector<RealGradient> > _grad_phi;
+    DenseVector<Real> _solution;
+    DenseVector<Real> _u_dot;
+    DenseVector<Real> _du_dot_du;
+    DenseVector<Real> _solution_old;
+  };
+
+  /// The dofs of a variable on an element of a mesh with n_vars variables
+  void dofIndices(const ElementData & data, unsigned int elem, unsigned int var, unsigned int n_vars, std::vector<dof_id_type> & dof_indices);
+
+  /// The fused loop MooseVariable::computeElemValues() used before the batched interpolation
+  void oldPath(const ElementData & data, const std::vector<dof_id_type> & dof_indices, bool need_u_old, QpValues & values);
+
+  /// Gather the dof values, then interpolate every quantity on its own (what MooseVariable does now)
+  void newPath(const ElementData & data, const std::vector<dof_id_type> & dof_indices, bool need_u_old, QpValues & values);
+
+  /// Compare both paths on a few elements of a mesh with 1 to 10 variables
+  void compare(unsigned int n_dofs, unsigned int n_qp);
+
+  /// Seconds spent computing the values of n_vars variables on n_elems elements with one of the paths
+  double time(const ElementData & data, unsigned int n_elems, unsigned int n_vars, bool old_path);
+
+  /// Scratch space of newPath()
+  std::vector<Real> _dof_values;
+};
+
+#endif  // DOFINTERPOLATIONTEST_H
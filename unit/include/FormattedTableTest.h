@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FORMATTEDTABLETEST_H
+#define FORMATTEDTABLETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class FormattedTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( FormattedTableTest );
+
+  CPPUNIT_TEST( rows );
+  CPPUNIT_TEST( window );
+  CPPUNIT_TEST( appendCSV );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void rows();
+  void window();
+  void appendCSV();
+};
+
+#endif  // FORMATTEDTABLETEST_H
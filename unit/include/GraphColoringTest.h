@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GRAPHCOLORINGTEST_H
+#define GRAPHCOLORINGTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "GraphColoring.h"
+
+class GraphColoringTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( GraphColoringTest );
+
+  CPPUNIT_TEST( tridiagonalTest );
+  CPPUNIT_TEST( gridTest );
+  CPPUNIT_TEST( unsymmetricTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void tridiagonalTest();
+  void gridTest();
+  void unsymmetricTest();
+
+private:
+  /// Check that no row has two nonzeros in columns of the same color
+  bool validColoring(const std::vector<std::vector<unsigned int> > & rows, const std::vector<unsigned int> & colors, unsigned int n_colors);
+};
+
+#endif  // GRAPHCOLORINGTEST_H
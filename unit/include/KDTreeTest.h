@@ -0,0 +1,57 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREETEST_H
+#define KDTREETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "KDTree.h"
+
+class KDTreeTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( KDTreeTest );
+
+  CPPUNIT_TEST( nearestTest );
+  CPPUNIT_TEST( batchNearestTest );
+  CPPUNIT_TEST( kNearestTest );
+  CPPUNIT_TEST( withinRadiusTest );
+  CPPUNIT_TEST( refitTest );
+  CPPUNIT_TEST( emptyTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  KDTreeTest();
+  ~KDTreeTest();
+
+  void nearestTest();
+  void batchNearestTest();
+  void kNearestTest();
+  void withinRadiusTest();
+  void refitTest();
+  void emptyTest();
+
+private:
+  /// Index of the point closest to p found by looking at all of them
+  unsigned int bruteForceNearest(const std::vector<Point> & points, const Point & p);
+
+  std::vector<Point> _points;
+  std::vector<Point> _queries;
+};
+
+#endif  // KDTREETEST_H
@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef MULTILINEARTABLETEST_H
+#define MULTILINEARTABLETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class MultilinearTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( MultilinearTableTest );
+
+  CPPUNIT_TEST( linear );
+  CPPUNIT_TEST( endValues );
+  CPPUNIT_TEST( singlePointAxis );
+  CPPUNIT_TEST( hunt );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void linear();
+  void endValues();
+  void singlePointAxis();
+  void hunt();
+
+private:
+  static const double _tol;
+};
+
+#endif  // MULTILINEARTABLETEST_H